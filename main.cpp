@@ -2,11 +2,30 @@
 
 #include "aobject/aobjecttest.h"
 #include "mobject/mobjecttest.h"
+#include "nobject/nbulkquery.h"
+#include "nobject/nindex.h"
 #include "nobject/nobjecttest.h"
+#include "nobject/nparallelevaluation.h"
 #include "sobject/sobjecttest.h"
 
+#include <QEventLoop>
+#include <QFile>
+#include <QPoint>
+#include <QPointF>
+#include <QRegularExpression>
+#include <QScopeGuard>
 #include <QSignalSpy>
 #include <QTest>
+#include <QThread>
+#include <QThreadPool>
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
 
 namespace {
 
@@ -15,6 +34,7 @@ using mpropertytest::MObjectTest;
 using npropertytest::NObjectMacro;
 using npropertytest::NObjectModern;
 using npropertytest::NObjectLegacy;
+using spropertytest::SObjectReset;
 using spropertytest::SObjectTest;
 
 /// The following is a system of concepts, constants and flags that
@@ -36,228 +56,3052 @@ enum Feature
     ClassInfo               = 1 << 9,
     Interfaces              = 1 << 10,
     Enumerators             = 1 << 11,
+    SignalEmissions         = 1 << 12,
+};
+
+/// By default all features are considered enabled, and no features are skipped.
+///
+template<class T = void> constexpr auto implementedFeatures = ~Feature::None;
+template<class T = void> constexpr auto skippedFeatures = Feature::None;
+
+/// Now the constants and concepts to disable features.
+///
+template<Feature feature, class T>
+constexpr bool isImplementedFeature = (implementedFeatures<T> & feature) == feature;
+
+template<Feature feature, class T>
+constexpr bool isSkippedFeature = (skippedFeatures<T> & feature) == feature;
+
+template<class T, Feature feature>
+concept HasFeature = (isImplementedFeature<feature, T>
+                      && !isSkippedFeature<feature, T>);
+
+/// Finally the type specific feature configurations.
+///
+template<> constexpr auto implementedFeatures<AObjectTest>
+    = implementedFeatures<>
+      & ~UniquePropertyIds      // properties do not have their own objects with moc
+      & ~PropertyAddresses      // properties do not have their own objects with moc
+      & ~NotifyPointers         // properties do not have their own objects with moc
+    ;
+
+template<> constexpr auto implementedFeatures<SObjectTest>
+    = implementedFeatures<>
+      & ~UniquePropertyIds      // properties do not have their own objects with moc
+      & ~PropertyAddresses      // properties do not have their own objects with moc
+      & ~NotifyPointers         // properties do not have their own objects with moc
+    ;
+
+template<> constexpr auto implementedFeatures<MObjectTest>
+    = implementedFeatures<>
+      & ~ClassInfo
+      & ~Interfaces
+      & ~Enumerators
+    ;
+
+template<> constexpr auto skippedFeatures<NObjectLegacy>
+    = skippedFeatures<>
+      | SignalAddresses
+      | PropertyChanges
+      | PropertyNotifications
+      | NotifyPointers
+      | SignalEmissions
+    ;
+
+/// Just a tiny wrapper with simple name for the pretty verbose
+/// `!std::is_member_function_pointer_v<decltype(&T::member)>`.
+///
+template<auto pointer>
+constexpr bool isDataMember = std::is_member_pointer_v<decltype(pointer)>
+                              && !std::is_member_function_pointer_v<decltype(pointer)>;
+
+/// Allow to run templated test function for different types
+///
+#define MAKE_TESTDATA(Feature) \
+    makeTestData<Feature, decltype([](auto &object) { \
+        test##Feature(object); \
+    })>()
+
+
+/// Simply show an expression and its value.
+///
+#define SHOW(What) qInfo() << #What " =>" << (What)
+
+
+/// Some constants for property related tests
+///
+const auto  constant1 = u"I am constant"_qs;
+const auto notifying1 = u"I am observing"_qs;
+const auto notifying2 = u"I have been changed per method"_qs;
+const auto  writable1 = u"I am modifiable"_qs;
+const auto  writable2 = u"I have been changed per setter"_qs;
+const auto  writable3 = u"I have been changed by assignment"_qs;
+const auto  metacall1 = u"I have been changed per metacall"_qs;
+
+const auto notifyingSpy1 = QList<QVariantList>{};
+const auto notifyingSpy2 = QList<QVariantList>{{notifying2}};
+
+const auto writableSpy1  = QList<QVariantList>{};
+const auto writableSpy2  = QList<QVariantList>{{writable2}};
+const auto writableSpy3  = QList<QVariantList>{{writable2}, {metacall1}};
+const auto writableSpy4  = QList<QVariantList>{{writable2}, {metacall1}, {writable3}};
+
+/// Registers the property `Name` with the given `Label`, for the macros below.
+///
+#define NPROPERTYTEST_REGISTER_PROPERTY(Name, Label) \
+    QT_WARNING_PUSH \
+    QT_WARNING_DISABLE_GCC("-Winvalid-offsetof") \
+    QT_WARNING_DISABLE_CLANG("-Winvalid-offsetof") \
+    static consteval auto member(::nproperty::detail::Tag<Label>) \
+    { return makeProperty<&TargetType::Name>(#Name, NPROPERTY_MEMBER_OFFSET(TargetType, Name)); } \
+    QT_WARNING_POP
+
+/// Declares a notifying property named `pABC` for benchmarking purposes.
+/// All properties of a class are generated from a single source line,
+/// therefore their labels count up from that line, instead of using
+/// a line number each.
+///
+#define NPROPERTYTEST_SIGNAL_PROPERTY(A, B, C) \
+    Property<bool, __LINE__ + (A * 100 + B * 10 + C), ::nproperty::Feature::Notify> p##A##B##C = {}; \
+    NPROPERTYTEST_REGISTER_PROPERTY(p##A##B##C, __LINE__ + (A * 100 + B * 10 + C))
+
+#define NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, B) \
+    NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 0) NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 1) \
+    NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 2) NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 3) \
+    NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 4) NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 5) \
+    NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 6) NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 7) \
+    NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 8) NPROPERTYTEST_SIGNAL_PROPERTY(A, B, 9)
+
+#define NPROPERTYTEST_SIGNAL_PROPERTIES_100(A) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 0) NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 1) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 2) NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 3) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 4) NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 5) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 6) NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 7) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 8) NPROPERTYTEST_SIGNAL_PROPERTIES_10(A, 9)
+
+#define NPROPERTYTEST_SIGNAL_PROPERTIES_1000() \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(0) NPROPERTYTEST_SIGNAL_PROPERTIES_100(1) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(2) NPROPERTYTEST_SIGNAL_PROPERTIES_100(3) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(4) NPROPERTYTEST_SIGNAL_PROPERTIES_100(5) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(6) NPROPERTYTEST_SIGNAL_PROPERTIES_100(7) \
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(8) NPROPERTYTEST_SIGNAL_PROPERTIES_100(9)
+
+/// Declares the writable property `input` of a dependency graph for benchmarking purposes.
+/// Like above all properties of the graph are generated from a single source line.
+///
+#define NPROPERTYTEST_GRAPH_INPUT() \
+    Property<int, __LINE__, ::nproperty::Feature::Write> input = 0; \
+    NPROPERTYTEST_REGISTER_PROPERTY(input, __LINE__)
+
+/// Declares the computed property `cABC` of a dependency chain,
+/// which reads the property declared in front of it.
+///
+#define NPROPERTYTEST_CHAIN_PROPERTY(A, B, C) \
+    Property<int, __LINE__ + (A * 100 + B * 10 + C) + 1, ::nproperty::Feature::Computed> c##A##B##C \
+        = [](const TargetType &self) { \
+            ++self.computations; \
+            return readLink<__LINE__ + (A * 100 + B * 10 + C)>(self) + 1; \
+        }; \
+    NPROPERTYTEST_REGISTER_PROPERTY(c##A##B##C, __LINE__ + (A * 100 + B * 10 + C) + 1)
+
+#define NPROPERTYTEST_CHAIN_PROPERTIES_10(A, B) \
+    NPROPERTYTEST_CHAIN_PROPERTY(A, B, 0) NPROPERTYTEST_CHAIN_PROPERTY(A, B, 1) \
+    NPROPERTYTEST_CHAIN_PROPERTY(A, B, 2) NPROPERTYTEST_CHAIN_PROPERTY(A, B, 3) \
+    NPROPERTYTEST_CHAIN_PROPERTY(A, B, 4) NPROPERTYTEST_CHAIN_PROPERTY(A, B, 5) \
+    NPROPERTYTEST_CHAIN_PROPERTY(A, B, 6) NPROPERTYTEST_CHAIN_PROPERTY(A, B, 7) \
+    NPROPERTYTEST_CHAIN_PROPERTY(A, B, 8) NPROPERTYTEST_CHAIN_PROPERTY(A, B, 9)
+
+#define NPROPERTYTEST_CHAIN_PROPERTIES_100(A) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 0) NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 1) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 2) NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 3) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 4) NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 5) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 6) NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 7) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 8) NPROPERTYTEST_CHAIN_PROPERTIES_10(A, 9)
+
+#define NPROPERTYTEST_CHAIN_PROPERTIES_1000() \
+    NPROPERTYTEST_CHAIN_PROPERTIES_100(0) NPROPERTYTEST_CHAIN_PROPERTIES_100(1) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_100(2) NPROPERTYTEST_CHAIN_PROPERTIES_100(3) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_100(4) NPROPERTYTEST_CHAIN_PROPERTIES_100(5) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_100(6) NPROPERTYTEST_CHAIN_PROPERTIES_100(7) \
+    NPROPERTYTEST_CHAIN_PROPERTIES_100(8) NPROPERTYTEST_CHAIN_PROPERTIES_100(9)
+
+/// Declares the computed properties `lABC`, `rABC`, and `sABC` of a stack of diamonds:
+/// The left and the right property read the property declared in front of them, which
+/// is the sink of the previous diamond. The sink reads the left and the right property.
+///
+#define NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, C) \
+    Property<int, __LINE__ + (A * 100 + B * 10 + C) * 3 + 1, ::nproperty::Feature::Computed> l##A##B##C \
+        = [](const TargetType &self) { \
+            ++self.computations; \
+            return readLink<__LINE__ + (A * 100 + B * 10 + C) * 3>(self) + 1; \
+        }; \
+    NPROPERTYTEST_REGISTER_PROPERTY(l##A##B##C, __LINE__ + (A * 100 + B * 10 + C) * 3 + 1) \
+    Property<int, __LINE__ + (A * 100 + B * 10 + C) * 3 + 2, ::nproperty::Feature::Computed> r##A##B##C \
+        = [](const TargetType &self) { \
+            ++self.computations; \
+            return readLink<__LINE__ + (A * 100 + B * 10 + C) * 3>(self) - 1; \
+        }; \
+    NPROPERTYTEST_REGISTER_PROPERTY(r##A##B##C, __LINE__ + (A * 100 + B * 10 + C) * 3 + 2) \
+    Property<int, __LINE__ + (A * 100 + B * 10 + C) * 3 + 3, ::nproperty::Feature::Computed> s##A##B##C \
+        = [](const TargetType &self) { \
+            ++self.computations; \
+            return (readLink<__LINE__ + (A * 100 + B * 10 + C) * 3 + 1>(self) \
+                    + readLink<__LINE__ + (A * 100 + B * 10 + C) * 3 + 2>(self)) / 2; \
+        }; \
+    NPROPERTYTEST_REGISTER_PROPERTY(s##A##B##C, __LINE__ + (A * 100 + B * 10 + C) * 3 + 3)
+
+#define NPROPERTYTEST_DIAMONDS_3(A, B) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 0) NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 1) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 2)
+
+#define NPROPERTYTEST_DIAMONDS_10(A, B) \
+    NPROPERTYTEST_DIAMONDS_3(A, B) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 3) NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 4) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 5) NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 6) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 7) NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 8) \
+    NPROPERTYTEST_DIAMOND_PROPERTIES(A, B, 9)
+
+#define NPROPERTYTEST_DIAMONDS_33(A) \
+    NPROPERTYTEST_DIAMONDS_10(A, 0) NPROPERTYTEST_DIAMONDS_10(A, 1) \
+    NPROPERTYTEST_DIAMONDS_10(A, 2) NPROPERTYTEST_DIAMONDS_3(A, 3)
+
+#define NPROPERTYTEST_DIAMONDS_100(A) \
+    NPROPERTYTEST_DIAMONDS_10(A, 0) NPROPERTYTEST_DIAMONDS_10(A, 1) \
+    NPROPERTYTEST_DIAMONDS_10(A, 2) NPROPERTYTEST_DIAMONDS_10(A, 3) \
+    NPROPERTYTEST_DIAMONDS_10(A, 4) NPROPERTYTEST_DIAMONDS_10(A, 5) \
+    NPROPERTYTEST_DIAMONDS_10(A, 6) NPROPERTYTEST_DIAMONDS_10(A, 7) \
+    NPROPERTYTEST_DIAMONDS_10(A, 8) NPROPERTYTEST_DIAMONDS_10(A, 9)
+
+#define NPROPERTYTEST_DIAMONDS_333() \
+    NPROPERTYTEST_DIAMONDS_100(0) NPROPERTYTEST_DIAMONDS_100(1) \
+    NPROPERTYTEST_DIAMONDS_100(2) NPROPERTYTEST_DIAMONDS_33(3)
+
+/// Declares the writable setting `sABC` of a configuration object, with the given `Features`,
+/// and with "default" as its declared default value.
+///
+#define NPROPERTYTEST_SETTING(Features, A, B, C) \
+    static QString defaultValue(::nproperty::detail::Tag<__LINE__ + (A * 100 + B * 10 + C)>) \
+    { return u"default"_qs; } \
+    Property<QString, __LINE__ + (A * 100 + B * 10 + C), Features> s##A##B##C = u"default"_qs; \
+    NPROPERTYTEST_REGISTER_PROPERTY(s##A##B##C, __LINE__ + (A * 100 + B * 10 + C))
+
+#define NPROPERTYTEST_SETTINGS_10(Features, A, B) \
+    NPROPERTYTEST_SETTING(Features, A, B, 0) NPROPERTYTEST_SETTING(Features, A, B, 1) \
+    NPROPERTYTEST_SETTING(Features, A, B, 2) NPROPERTYTEST_SETTING(Features, A, B, 3) \
+    NPROPERTYTEST_SETTING(Features, A, B, 4) NPROPERTYTEST_SETTING(Features, A, B, 5) \
+    NPROPERTYTEST_SETTING(Features, A, B, 6) NPROPERTYTEST_SETTING(Features, A, B, 7) \
+    NPROPERTYTEST_SETTING(Features, A, B, 8) NPROPERTYTEST_SETTING(Features, A, B, 9)
+
+#define NPROPERTYTEST_SETTINGS_100(Features, A) \
+    NPROPERTYTEST_SETTINGS_10(Features, A, 0) NPROPERTYTEST_SETTINGS_10(Features, A, 1) \
+    NPROPERTYTEST_SETTINGS_10(Features, A, 2) NPROPERTYTEST_SETTINGS_10(Features, A, 3) \
+    NPROPERTYTEST_SETTINGS_10(Features, A, 4) NPROPERTYTEST_SETTINGS_10(Features, A, 5) \
+    NPROPERTYTEST_SETTINGS_10(Features, A, 6) NPROPERTYTEST_SETTINGS_10(Features, A, 7) \
+    NPROPERTYTEST_SETTINGS_10(Features, A, 8) NPROPERTYTEST_SETTINGS_10(Features, A, 9)
+
+#define NPROPERTYTEST_SETTINGS_200(Features) \
+    NPROPERTYTEST_SETTINGS_100(Features, 0) NPROPERTYTEST_SETTINGS_100(Features, 1)
+
+/// Reads the property identified by `Label` for the computed properties generated
+/// above, which cannot name the property they read. The property is read by the
+/// same function `QMetaProperty::read()` uses, which is resolved at compile time.
+///
+template<nproperty::LabelId Label, class Object>
+int readLink(const Object &object)
+{
+    static constexpr auto readProperty = Object::member(nproperty::detail::Tag<Label>{}).readProperty;
+
+    auto value = 0;
+    readProperty(&object, &value);
+    return value;
+}
+
+/// Classes with many notifying properties, to measure signal lookup by `QObject::connect()`.
+/// They are defined here, instead of the nobject library, as they take considerable time
+/// to compile.
+///
+class NObjectSignals10 : public nproperty::Object<NObjectSignals10>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_SIGNAL_PROPERTIES_10(0, 0)
+};
+
+class NObjectSignals100 : public nproperty::Object<NObjectSignals100>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_SIGNAL_PROPERTIES_100(0)
+};
+
+class NObjectSignals1000 : public nproperty::Object<NObjectSignals1000>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_SIGNAL_PROPERTIES_1000()
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectSignals10)
+N_OBJECT_IMPLEMENTATION(NObjectSignals100)
+N_OBJECT_IMPLEMENTATION(NObjectSignals1000)
+
+/// A class with a rather large property, to measure the cost of reading it. The value
+/// is a `std::string`, as copies of implicitly shared types would be cheap anyway.
+///
+class NObjectBlob : public nproperty::Object<NObjectBlob>
+{
+    N_OBJECT
+
+public:
+    N_PROPERTY(std::string, blob) = std::string(1024 * 1024, 'x');
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectBlob)
+
+/// A class with a large container property, to measure the cost of modifying it.
+///
+class NObjectContainer : public nproperty::Object<NObjectContainer>
+{
+    N_OBJECT
+
+public:
+    N_PROPERTY(QList<QPointF>, points, ::nproperty::Feature::Write) = QList<QPointF>(10'000);
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectContainer)
+
+/// A class with a property for each change detection policy.
+///
+class NObjectComparison : public nproperty::Object<NObjectComparison>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(QString, equality, Write);
+    N_PROPERTY(QString, identity, Write | CompareIdentity);
+    N_PROPERTY(qreal,   fuzzy,    Write | CompareFuzzy);
+    N_PROPERTY(QString, hash,     Write | CompareHash);
+    N_PROPERTY(QString, always,   Write | AlwaysNotify);
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectComparison)
+
+/// A class with many properties that usually get updated together.
+///
+class NObjectBatch : public nproperty::Object<NObjectBatch>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int, p00, Write) = 0;
+    N_PROPERTY(int, p01, Write) = 0;
+    N_PROPERTY(int, p02, Write) = 0;
+    N_PROPERTY(int, p03, Write) = 0;
+    N_PROPERTY(int, p04, Write) = 0;
+    N_PROPERTY(int, p05, Write) = 0;
+    N_PROPERTY(int, p06, Write) = 0;
+    N_PROPERTY(int, p07, Write) = 0;
+    N_PROPERTY(int, p08, Write) = 0;
+    N_PROPERTY(int, p09, Write) = 0;
+    N_PROPERTY(int, p10, Write) = 0;
+    N_PROPERTY(int, p11, Write) = 0;
+    N_PROPERTY(int, p12, Write) = 0;
+    N_PROPERTY(int, p13, Write) = 0;
+    N_PROPERTY(int, p14, Write) = 0;
+    N_PROPERTY(int, p15, Write) = 0;
+    N_PROPERTY(int, p16, Write) = 0;
+    N_PROPERTY(int, p17, Write) = 0;
+    N_PROPERTY(int, p18, Write) = 0;
+    N_PROPERTY(int, p19, Write) = 0;
+
+    void forEachProperty(const auto &function)
+    {
+        function(p00);
+        function(p01);
+        function(p02);
+        function(p03);
+        function(p04);
+        function(p05);
+        function(p06);
+        function(p07);
+        function(p08);
+        function(p09);
+        function(p10);
+        function(p11);
+        function(p12);
+        function(p13);
+        function(p14);
+        function(p15);
+        function(p16);
+        function(p17);
+        function(p18);
+        function(p19);
+    }
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectBatch)
+
+/// A class with a property that changes at high frequency, like some progress,
+/// or some sensor reading, once with immediate and once with coalesced notifications.
+///
+class NObjectCoalesce : public nproperty::Object<NObjectCoalesce>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int, immediate, Write)            = 0;
+    N_PROPERTY(int, coalesced, Write | Coalesce) = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectCoalesce)
+
+/// A class with a property that changes at high frequency, like some sensor reading,
+/// once with immediate and once with throttled notifications.
+///
+class NObjectThrottle : public nproperty::Object<NObjectThrottle>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    static constexpr auto interval = std::chrono::milliseconds{20};
+
+    N_PROPERTY(int, immediate, Write)                                  = 0;
+    N_PROPERTY(int, throttled, Write | nproperty::throttled(interval)) = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectThrottle)
+
+/// A class with properties that are read by other threads, like the
+/// position of some item that's read by a render thread.
+///
+class NObjectAtomic : public nproperty::Object<NObjectAtomic>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(qint64,  counter,  Write | Atomic) = 0;
+    N_PROPERTY(QPoint,  position, Write | Atomic) = {};
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectAtomic)
+
+/// A class with several properties that other threads must read consistently,
+/// like the geometry of some item that's read by a render thread.
+///
+class NObjectSnapshot : public nproperty::Object<NObjectSnapshot>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(qreal, x,      Write) = 0;
+    N_PROPERTY(qreal, y,      Write) = 0;
+    N_PROPERTY(qreal, width,  Write) = 0;
+    N_PROPERTY(qreal, height, Write) = 0;
+    N_PROPERTY(QString, title, Write);
+
+    void setGeometry(qreal value)
+    {
+        const auto batch = batchNotifications();
+
+        x      = value;
+        y      = value;
+        width  = value;
+        height = value;
+    }
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectSnapshot)
+
+/// A class with properties that are updated by worker threads, like
+/// the progress and status of some background job.
+///
+class NObjectPostedWrites : public nproperty::Object<NObjectPostedWrites>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int,     progress, Write) = 0;
+    N_PROPERTY(QString, status,   Write) = {};
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectPostedWrites)
+
+/// A class with a handful of properties that get synchronized with some storage.
+///
+class NObjectTracked : public nproperty::Object<NObjectTracked>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int, p0, Write) = 0;
+    N_PROPERTY(int, p1, Write) = 0;
+    N_PROPERTY(int, p2, Write) = 0;
+    N_PROPERTY(int, p3, Write) = 0;
+    N_PROPERTY(int, p4, Write) = 0;
+    N_PROPERTY(int, p5, Write) = 0;
+    N_PROPERTY(int, p6, Write) = 0;
+    N_PROPERTY(int, p7, Write) = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectTracked)
+
+/// Two classes of which there are many instances, like particles or
+/// scene items, once with inline and once with columnar storage.
+///
+class NObjectInline : public nproperty::Object<NObjectInline>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(qreal, weight, Write) = 1;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectInline)
+
+class NObjectColumnar : public nproperty::Object<NObjectColumnar>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(qreal, weight, Write | Columnar) = 1;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectColumnar)
+
+/// A class of which there are many instances that get queried as a whole,
+/// like the readings of some sensors.
+///
+class NObjectReading : public nproperty::Object<NObjectReading>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int,   count, Write) = 0;
+    N_PROPERTY(qreal, value, Write) = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectReading)
+
+/// A class of which there are many instances that get looked up by their properties,
+/// like the records of some database.
+///
+class NObjectRecord : public nproperty::Object<NObjectRecord>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int,     id,   Write) = 0;
+    N_PROPERTY(QString, name, Write) = {};
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectRecord)
+
+/// A class with computed properties, of which one depends on the other.
+///
+class NObjectComputed : public nproperty::Object<NObjectComputed>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int,     width,  Write) = 2;
+    N_PROPERTY(int,     height, Write) = 3;
+    N_PROPERTY(QString, title,  Write) = {};
+
+    N_PROPERTY(int, area, Computed) = [](const NObjectComputed &self) {
+        ++self.areaComputations;
+        return self.width() * self.height();
+    };
+
+    N_PROPERTY(bool, large, Computed) = [](const NObjectComputed &self) {
+        return self.area() > 10;
+    };
+
+    mutable int areaComputations = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectComputed)
+
+/// The same area, but updated by signal connections, like it's done without computed properties.
+///
+class NObjectConnected : public nproperty::Object<NObjectConnected>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    NObjectConnected()
+    {
+        width .connect(this, [this] { updateArea(); });
+        height.connect(this, [this] { updateArea(); });
+        updateArea();
+    }
+
+    N_PROPERTY(int, width,  Write)  = 2;
+    N_PROPERTY(int, height, Write)  = 3;
+    N_PROPERTY(int, area,   Notify) = 0;
+
+private:
+    void updateArea() { area = width() * height(); }
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectConnected)
+
+/// The classic diamond: Both, `left` and `right` depend on `input`, and `sink` depends on
+/// both of them. Immediate propagation would compute `sink` twice for each change of
+/// `input`, and the first time with an outdated value of `right`.
+///
+class NObjectDiamond : public nproperty::Object<NObjectDiamond>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int, input, Write) = 1;
+
+    N_PROPERTY(int, left, Computed) = [](const NObjectDiamond &self) {
+        return self.input() + 1;
+    };
+
+    N_PROPERTY(int, right, Computed) = [](const NObjectDiamond &self) {
+        return self.input() * 2;
+    };
+
+    N_PROPERTY(int, sink, Computed) = [](const NObjectDiamond &self) {
+        ++self.sinkComputations;
+        return self.left() + self.right();
+    };
+
+    [[nodiscard]] bool isConsistent() const
+    {
+        return left() == input() + 1 && right() == input() * 2 && sink() == left() + right();
+    }
+
+    mutable int sinkComputations = 0;
 };
 
-/// By default all features are considered enabled, and no features are skipped.
-///
-template<class T = void> constexpr auto implementedFeatures = ~Feature::None;
-template<class T = void> constexpr auto skippedFeatures = Feature::None;
+N_OBJECT_IMPLEMENTATION(NObjectDiamond)
+
+/// Like `NObjectDiamond`, but the sink is declared in front of the properties it reads,
+/// and it only reads them once the input exceeds 2. The topological order therefore
+/// must be derived from the dependencies recorded, once the sink has read them.
+///
+class NObjectReversedDiamond : public nproperty::Object<NObjectReversedDiamond>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(int, input, Write) = 1;
+
+    N_PROPERTY(int, sink, Computed) = [](const NObjectReversedDiamond &self) {
+        return self.input() > 2 ? self.left() + self.right() : self.input();
+    };
+
+    N_PROPERTY(int, left, Computed) = [](const NObjectReversedDiamond &self) {
+        return self.input() + 1;
+    };
+
+    N_PROPERTY(int, right, Computed) = [](const NObjectReversedDiamond &self) {
+        return self.input() * 2;
+    };
+
+    [[nodiscard]] bool isConsistent() const
+    {
+        return left() == input() + 1 && right() == input() * 2
+                && sink() == (input() > 2 ? left() + right() : input());
+    }
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectReversedDiamond)
+
+/// Classes with dependency graphs of 10 to 1000 computed properties, to measure
+/// the propagation of changes: Deep chains, and stacks of diamonds. They are
+/// limited to 1000 properties, as the size of the member tables, which are built
+/// at compile time, grows with the size of the class.
+///
+class NObjectChain10 : public nproperty::Object<NObjectChain10>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_CHAIN_PROPERTIES_10(0, 0)
+
+    static constexpr auto sink = &NObjectChain10::c009;
+    static constexpr auto nodeCount = 10;
+
+    mutable int computations = 0;
+};
+
+class NObjectChain100 : public nproperty::Object<NObjectChain100>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_CHAIN_PROPERTIES_100(0)
+
+    static constexpr auto sink = &NObjectChain100::c099;
+    static constexpr auto nodeCount = 100;
+
+    mutable int computations = 0;
+};
+
+class NObjectChain1000 : public nproperty::Object<NObjectChain1000>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_CHAIN_PROPERTIES_1000()
+
+    static constexpr auto sink = &NObjectChain1000::c999;
+    static constexpr auto nodeCount = 1000;
+
+    mutable int computations = 0;
+};
+
+class NObjectDiamonds10 : public nproperty::Object<NObjectDiamonds10>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_DIAMONDS_3(0, 0)
+
+    static constexpr auto sink = &NObjectDiamonds10::s002;
+    static constexpr auto nodeCount = 10;
+
+    mutable int computations = 0;
+};
+
+class NObjectDiamonds100 : public nproperty::Object<NObjectDiamonds100>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_DIAMONDS_33(0)
+
+    static constexpr auto sink = &NObjectDiamonds100::s032;
+    static constexpr auto nodeCount = 100;
+
+    mutable int computations = 0;
+};
+
+class NObjectDiamonds1000 : public nproperty::Object<NObjectDiamonds1000>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_GRAPH_INPUT() NPROPERTYTEST_DIAMONDS_333()
+
+    static constexpr auto sink = &NObjectDiamonds1000::s332;
+    static constexpr auto nodeCount = 1000;
+
+    mutable int computations = 0;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectChain10)
+N_OBJECT_IMPLEMENTATION(NObjectChain100)
+N_OBJECT_IMPLEMENTATION(NObjectChain1000)
+N_OBJECT_IMPLEMENTATION(NObjectDiamonds10)
+N_OBJECT_IMPLEMENTATION(NObjectDiamonds100)
+N_OBJECT_IMPLEMENTATION(NObjectDiamonds1000)
+
+/// A class with computed properties that are expensive to compute, like the
+/// statistics of some data series shown by a dashboard. The expensive work
+/// is simulated by iterating a bijective mixing function, so that each change
+/// of the input also changes the computed properties.
+///
+class NObjectStatistics : public nproperty::Object<NObjectStatistics>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    static constexpr auto rounds = 5000;
+
+    N_PROPERTY(int, input, Write) = 0;
+
+    N_PROPERTY(quint32, checksum, Computed) = [](const NObjectStatistics &self) {
+        return mix(static_cast<quint32>(self.input()));
+    };
+
+    N_PROPERTY(quint32, summary, Computed) = [](const NObjectStatistics &self) {
+        return mix(self.checksum());
+    };
+
+    static quint32 mix(quint32 value) noexcept
+    {
+        for (auto i = 0; i < rounds; ++i) {
+            value ^= value << 13;
+            value ^= value >> 17;
+            value ^= value << 5;
+        }
+
+        return value;
+    }
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectStatistics)
+
+/// A class with resetable properties, and the same class without reset.
+/// Both must have the same size, as default values are stored per class.
+///
+class NObjectReset : public nproperty::Object<NObjectReset>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY_WITH_DEFAULT(QString, title, u"untitled"_qs, Write | Reset);
+    N_PROPERTY_WITH_DEFAULT(int,     count, 1,              Write | Reset);
+};
+
+class NObjectNoReset : public nproperty::Object<NObjectNoReset>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    N_PROPERTY(QString, title, Write) = u"untitled"_qs;
+    N_PROPERTY(int,     count, Write) = 1;
+};
+
+/// A class with resetable properties, whose constructor initializes them with other
+/// values than their default. It's only used by `testResetDefaultOfFirstObject()`,
+/// so that the first object of this class is constructed there.
+///
+class NObjectCustomReset : public nproperty::Object<NObjectCustomReset>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    explicit NObjectCustomReset(int count)
+        : count{count}
+    {}
+
+    N_PROPERTY_WITH_DEFAULT(int, count, 1, Write | Reset);
+    N_PROPERTY(int, plain, Write | Reset) = 5;
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectReset)
+N_OBJECT_IMPLEMENTATION(NObjectNoReset)
+N_OBJECT_IMPLEMENTATION(NObjectCustomReset)
+
+/// Configuration objects with 200 settings, of which usually only a few differ from
+/// their default. They are stored sparsely by the first class, and inline by the second.
+///
+class NObjectSparseSettings : public nproperty::Object<NObjectSparseSettings>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_SETTINGS_200(::nproperty::Feature::Write | ::nproperty::Feature::Sparse)
+};
+
+class NObjectInlineSettings : public nproperty::Object<NObjectInlineSettings>
+{
+    N_OBJECT
+
+public:
+    NPROPERTYTEST_SETTINGS_200(::nproperty::Feature::Write)
+};
+
+/// Sparse settings, whose constructor initializes them with other values than their
+/// default. It's only used by `testSparseDefaultOfFirstObject()`, so that the first
+/// object of this class is constructed there.
+///
+class NObjectCustomSparse : public nproperty::Object<NObjectCustomSparse>
+{
+    N_OBJECT
+
+public:
+    using enum nproperty::Feature;
+
+    explicit NObjectCustomSparse(QString name)
+        : name{std::move(name)}
+    {}
+
+    N_PROPERTY_WITH_DEFAULT(QString, name,  u"unnamed"_qs, Write | Sparse);
+    N_PROPERTY_WITH_DEFAULT(int,     level, 3,             Write | Sparse);
+};
+
+N_OBJECT_IMPLEMENTATION(NObjectSparseSettings)
+N_OBJECT_IMPLEMENTATION(NObjectInlineSettings)
+N_OBJECT_IMPLEMENTATION(NObjectCustomSparse)
+
+/// Reports the resident set size of this process in bytes, or 0 if that's unknown.
+///
+static qint64 residentSetSize()
+{
+#ifdef Q_OS_LINUX
+    auto statm = QFile{u"/proc/self/statm"_qs};
+
+    if (statm.open(QFile::ReadOnly)) {
+        const auto fields = statm.readAll().split(' ');
+
+        if (fields.size() > 1)
+            return fields[1].toLongLong() * sysconf(_SC_PAGESIZE);
+    }
+#endif
+
+    return 0;
+}
+
+/// The property experiment is implemented as Qt Test suite.
+///
+class PropertyExperiment: public QObject
+{
+    Q_OBJECT
+
+    /// --------------------------------------------------------------------------------------------
+    /// Normally one would just make the type under test template argument of this class.
+    /// Unfortunately moc doesn't support template types. Therefore a different approach
+    /// is needed here to provide (almost) identical tests for each property system.
+    ///
+    /// The actual tests are implemented in template functions. The _data() slots of each
+    /// test simply push a type erased delegate to the test data set, which then is run
+    /// by the actual test slot. Sounds complicated, but isn't too much. Foremost it's
+    /// pretty canonical as you can see below.
+    /// --------------------------------------------------------------------------------------------
+
+private slots:
+    void testMetaObject()                   { runFeatureTest(); }
+    void testMetaObject_data()              { MAKE_TESTDATA(MetaObject); }
+
+    void testPropertyDefinitions()          { runFeatureTest(); }
+    void testPropertyDefinitions_data()     { MAKE_TESTDATA(PropertyDefinitions); }
+
+    void testUniquePropertyIds()            { runFeatureTest(); }
+    void testUniquePropertyIds_data()       { MAKE_TESTDATA(UniquePropertyIds); }
+
+    void testPropertyAddresses()            { runFeatureTest(); }
+    void testPropertyAddresses_data()       { MAKE_TESTDATA(PropertyAddresses); }
+
+    void testMethodDefinitions()            { runFeatureTest(); }
+    void testMethodDefinitions_data()       { MAKE_TESTDATA(MethodDefinitions); }
+
+    void testSignalAddresses()              { runFeatureTest(); }
+    void testSignalAddresses_data()         { MAKE_TESTDATA(SignalAddresses); }
+
+    void testNotifyPointers()               { runFeatureTest(); }
+    void testNotifyPointers_data()          { MAKE_TESTDATA(NotifyPointers); }
+
+    void testPropertyChanges()              { runBenchmark(); }
+    void testPropertyChanges_data()         { MAKE_TESTDATA(PropertyChanges); }
+
+    void testPropertyNotifications()        { runBenchmark(); }
+    void testPropertyNotifications_data()   { MAKE_TESTDATA(PropertyNotifications); }
+
+    void testSignalEmissions()              { runBenchmark(); }
+    void testSignalEmissions_data()         { MAKE_TESTDATA(SignalEmissions); }
+
+    void testChangeNotifications()          { runFeatureTest(); }
+    void testChangeNotifications_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        makeChangeNotificationRows<AObjectTest>  ();
+        makeChangeNotificationRows<MObjectTest>  ();
+        makeChangeNotificationRows<NObjectMacro> ();
+        makeChangeNotificationRows<NObjectModern>();
+        makeChangeNotificationRows<NObjectLegacy>();
+        makeChangeNotificationRows<SObjectTest>  ();
+    }
+
+    void testClassInfo()                    { runFeatureTest(); }
+    void testClassInfo_data()               { MAKE_TESTDATA(ClassInfo); }
+
+    void testInterfaces()                   { runBenchmark(); }
+    void testInterfaces_data()              { MAKE_TESTDATA(Interfaces); }
+
+    void testEnumerators()                  { runFeatureTest(); }
+    void testEnumerators_data()             { MAKE_TESTDATA(Enumerators); }
+
+    /// --------------------------------------------------------------------------------------------
+    /// An NObject specific test, testing its HelloWorld class and unique features
+    /// --------------------------------------------------------------------------------------------
+
+    void testNObject()
+    {
+        using npropertytest::HelloWorld;
+
+        auto object     = HelloWorld{};
+        auto metaObject = object.staticMetaObject;
+
+        SHOW(object.hello.label());
+        SHOW(object.world.label());
+
+        SHOW(object.hello.name());
+        SHOW(object.world.name());
+
+        SHOW(object.hello.value());
+        SHOW(object.world.value());
+
+        SHOW(object.hello());
+        SHOW(object.world());
+
+        SHOW(object.hello);
+        SHOW(object.world);
+
+        const auto indices = QSet{object.hello.label(),
+                                  object.world.label()};
+
+        QCOMPARE(indices.count(), 2);
+
+        QCOMPARE(object.hello.name(), "hello");
+        QCOMPARE(object.world.name(), "world");
+
+        SHOW(object.hello.features().value);
+        SHOW(object.world.features().value);
+
+        static_assert( object.hello.isReadable());
+        static_assert(!object.hello.isResetable());
+        static_assert(!object.hello.isNotifiable());
+        static_assert(!object.hello.isWritable());
+
+        static_assert( object.world.isReadable());
+        static_assert(!object.world.isResetable());
+        static_assert( object.world.isNotifiable());
+        static_assert( object.world.isWritable());
+
+        SHOW(metaObject.property(1).read(&object));
+        SHOW(metaObject.property(2).read(&object));
+
+        connect(&object, object.world.notifyPointer(), this, [](int newValue) {
+            qInfo("World has changed to %d...", newValue);
+        });
+
+        object.world.connect(this, [](int newValue) {
+            qInfo("The world totally has changed to %d...", newValue);
+        });
+
+        object.world = 13;
+
+        using nproperty::detail::Prototype;
+
+        // The objects returned by Prototype::get() are uninitialized, unconstructed data.
+        // The test will randomly crash when QCOMPARE() doesn't try to read metaObject(),
+        // and the like.
+
+        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()),
+                 reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()));
+
+        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()),
+                 reinterpret_cast<quintptr>(Prototype::get<NObjectMacro>()));
+
+        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello)),
+                 reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello)));
+
+        QVERIFY(reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello))
+             != reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::world)));
+    }
+
+    /// --------------------------------------------------------------------------------------------
+    /// Verify that metaobjects generated at compile time match those built by QMetaObjectBuilder
+    /// --------------------------------------------------------------------------------------------
+
+    void testGeneratedMetaObject_data()
+    {
+        QTest::addColumn<MetaObjectPointer>  ("generated");
+        QTest::addColumn<TestFunctionPointer>("buildMetaObject");
+
+        makeGeneratedMetaObjectRow<npropertytest::HelloWorld>();
+        makeGeneratedMetaObjectRow<NObjectMacro>();
+        makeGeneratedMetaObjectRow<NObjectModern>();
+        makeGeneratedMetaObjectRow<NObjectLegacy>();
+    }
+
+    void testGeneratedMetaObject()
+    {
+        const QFETCH(MetaObjectPointer, generated);
+        const QFETCH(TestFunctionPointer, buildMetaObject);
+
+        if (generated == nullptr)
+            QSKIP("Metaobjects cannot be generated for this version of Qt");
+
+        // The metaobject is built here, instead of in the _data function,
+        // so that it also gets released if this row is not selected.
+        const auto built = reinterpret_cast<MetaObjectFactory>(buildMetaObject)();
+        const auto cleanup = qScopeGuard([built] {
+            std::free(const_cast<QMetaObject *>(built));
+        });
+
+        QCOMPARE(generated->className(),       built->className());
+        QCOMPARE(generated->superClass(),      built->superClass());
+        QCOMPARE(generated->classInfoCount(),  built->classInfoCount());
+        QCOMPARE(generated->methodCount(),     built->methodCount());
+        QCOMPARE(generated->propertyCount(),   built->propertyCount());
+        QCOMPARE(generated->enumeratorCount(), built->enumeratorCount());
+        QCOMPARE(generated->metaType(),        built->metaType());
+
+        for (auto i = generated->classInfoOffset(); i < generated->classInfoCount(); ++i) {
+            QCOMPARE(generated->classInfo(i).name(),  built->classInfo(i).name());
+            QCOMPARE(generated->classInfo(i).value(), built->classInfo(i).value());
+        }
+
+        for (auto i = generated->methodOffset(); i < generated->methodCount(); ++i) {
+            const auto expected = built->method(i);
+            const auto actual   = generated->method(i);
+
+            QCOMPARE(actual.methodSignature(),      expected.methodSignature());
+            QCOMPARE(actual.methodType(),           expected.methodType());
+            QCOMPARE(actual.access(),               expected.access());
+            QCOMPARE(actual.returnMetaType(),       expected.returnMetaType());
+            QCOMPARE(actual.parameterCount(),       expected.parameterCount());
+            QCOMPARE(actual.parameterMetaType(0),   expected.parameterMetaType(0));
+            QCOMPARE(actual.parameterNames(),       expected.parameterNames());
+            QCOMPARE(actual.tag(),                  expected.tag());
+        }
+
+        for (auto i = generated->propertyOffset(); i < generated->propertyCount(); ++i) {
+            const auto expected = built->property(i);
+            const auto actual   = generated->property(i);
+
+            QCOMPARE(actual.name(),                 expected.name());
+            QCOMPARE(actual.metaType(),             expected.metaType());
+            QCOMPARE(actual.isReadable(),           expected.isReadable());
+            QCOMPARE(actual.isWritable(),           expected.isWritable());
+            QCOMPARE(actual.isResettable(),         expected.isResettable());
+            QCOMPARE(actual.isDesignable(),         expected.isDesignable());
+            QCOMPARE(actual.isScriptable(),         expected.isScriptable());
+            QCOMPARE(actual.isStored(),             expected.isStored());
+            QCOMPARE(actual.isConstant(),           expected.isConstant());
+            QCOMPARE(actual.isFinal(),              expected.isFinal());
+            QCOMPARE(actual.isEnumType(),           expected.isEnumType());
+            QCOMPARE(actual.hasStdCppSet(),         expected.hasStdCppSet());
+            QCOMPARE(actual.notifySignalIndex(),    expected.notifySignalIndex());
+        }
+
+        for (auto i = generated->enumeratorOffset(); i < generated->enumeratorCount(); ++i) {
+            const auto expected = built->enumerator(i);
+            const auto actual   = generated->enumerator(i);
+
+            QCOMPARE(actual.name(),                 expected.name());
+            QCOMPARE(actual.enumName(),             expected.enumName());
+            QCOMPARE(actual.isFlag(),               expected.isFlag());
+            QCOMPARE(actual.isScoped(),             expected.isScoped());
+            QCOMPARE(actual.keyCount(),             expected.keyCount());
+
+            for (auto k = 0; k < actual.keyCount(); ++k) {
+                QCOMPARE(actual.key(k),             expected.key(k));
+                QCOMPARE(actual.value(k),           expected.value(k));
+            }
+        }
+    }
+
+    /// --------------------------------------------------------------------------------------------
+    /// Compare the startup cost of metaobjects built by QMetaObjectBuilder with generated ones
+    /// --------------------------------------------------------------------------------------------
+
+    void testMetaObjectCreation_data()
+    {
+        QTest::addColumn<bool>("generated");
+
+        QTest::newRow("builder")   << false;
+        QTest::newRow("generated") << true;
+    }
+
+    void testMetaObjectCreation()
+    {
+        using MetaObject = NObjectMacro::MetaObject;
+
+        const QFETCH(bool, generated);
+
+        if (generated && MetaObject::generatedMetaObject() == nullptr)
+            QSKIP("Metaobjects cannot be generated for this version of Qt");
+
+        // Each metaobject is created from scratch, and then queried once,
+        // so that the generated tables actually get read, like on startup.
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                if (generated) {
+                    const auto metaObject = MetaObject::makeGeneratedMetaObject();
+                    QVERIFY(metaObject.indexOfProperty("writable") >= 0);
+                } else {
+                    const auto metaObject = MetaObject::buildMetaObject();
+                    const auto cleanup = qScopeGuard([metaObject] {
+                        std::free(const_cast<QMetaObject *>(metaObject));
+                    });
+
+                    QVERIFY(metaObject->indexOfProperty("writable") >= 0);
+                }
+            }
+        }
+    }
+
+    /// --------------------------------------------------------------------------------------------
+    /// Measure the member lookups behind QObject::connect() and qobject_cast()
+    /// --------------------------------------------------------------------------------------------
+
+    void testSignalLookup()
+    {
+        auto object = NObjectMacro{};
+        auto receivedCount = 0;
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                const auto connection = connect(&object, &NObjectMacro::writableChanged,
+                                                this, [&receivedCount] { ++receivedCount; });
+
+                QVERIFY(connection);
+                disconnect(connection);
+            }
+        }
+
+        QCOMPARE(receivedCount, 0);
+    }
+
+    void testMetaCast_data()
+    {
+        QTest::addColumn<QByteArray>("name");
+
+        QTest::newRow("class")      << QByteArray{NObjectMacro::staticMetaObject.className()};
+        QTest::newRow("super")      << "experiment::ParentClass"_qba;
+        QTest::newRow("interface")  << "experiment::InterfaceTwo"_qba;
+        QTest::newRow("iid")        << "experiment/InterfaceTwo/1.0"_qba;
+        QTest::newRow("ancestor")   << "QObject"_qba;
+        QTest::newRow("nonsense")   << "nonsense"_qba;
+    }
+
+    void testMetaCast()
+    {
+        const QFETCH(QByteArray, name);
+
+        auto object = NObjectMacro{};
+        const auto expected = object.qt_metacast(name.constData());
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i)
+                QCOMPARE(object.qt_metacast(name.constData()), expected);
+        }
+    }
+
+    void testLargePropertyReads_data()
+    {
+        QTest::addColumn<bool>("useMetaProperty");
+
+        QTest::newRow("direct")       << false;
+        QTest::newRow("metaproperty") << true;
+    }
+
+    void testLargePropertyReads()
+    {
+        const QFETCH(bool, useMetaProperty);
+
+        auto object = NObjectBlob{};
+        auto totalSize = std::size_t{0};
+
+        const auto metaObject = object.metaObject();
+        const auto metaProperty = metaObject->property(metaObject->indexOfProperty("blob"));
+        QVERIFY(metaProperty.isValid());
+
+        if (useMetaProperty) {
+            QBENCHMARK {
+                for (auto i = 0; i < 1000; ++i)
+                    totalSize += metaProperty.read(&object).value<std::string>().size();
+            }
+        } else {
+            QBENCHMARK {
+                for (auto i = 0; i < 1000; ++i)
+                    totalSize += object.blob().size();
+            }
+        }
+
+        QCOMPARE_GE(totalSize, std::size_t{1000} * 1024 * 1024);
+    }
+
+    void testPropertyModification()
+    {
+        auto object = NObjectContainer{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        object.points.connect(&context, [&receivedCount] { ++receivedCount; });
+
+        object.points.modify([](QList<QPointF> &points) {
+            points[0] = {1, 2};
+            points[1] = {3, 4};
+        });
+
+        QCOMPARE(receivedCount, 1);
+        QCOMPARE(object.points().at(0), QPointF(1, 2));
+        QCOMPARE(object.points().at(1), QPointF(3, 4));
+
+        object.points.modify([](QList<QPointF> &) {
+            return false;
+        });
+
+        QCOMPARE(receivedCount, 1);
+    }
+
+    void testContainerMetaProperty()
+    {
+        auto object = NObjectContainer{};
+        const auto metaObject = object.metaObject();
+        const auto metaProperty = metaObject->property(metaObject->indexOfProperty("points"));
+
+        QVERIFY(metaProperty.isValid());
+        QCOMPARE(metaProperty.metaType(), QMetaType::fromType<QList<QPointF>>());
+
+        object.points.modify([](QList<QPointF> &points) { points[0] = {1, 2}; });
+
+        const auto points = metaProperty.read(&object).value<QList<QPointF>>();
+        QCOMPARE(points.size(), 10'000);
+        QCOMPARE(points.at(0), QPointF(1, 2));
+    }
+
+    void testContainerModification_data()
+    {
+        QTest::addColumn<bool>("useModify");
+
+        QTest::newRow("setValue") << false;
+        QTest::newRow("modify")   << true;
+    }
+
+    void testContainerModification()
+    {
+        const QFETCH(bool, useModify);
+
+        auto object = NObjectContainer{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        object.points.connect(&context, [&receivedCount] { ++receivedCount; });
+
+        if (useModify) {
+            QBENCHMARK {
+                for (auto i = 0; i < 1000; ++i) {
+                    object.points.modify([i](QList<QPointF> &points) {
+                        points[i] = {static_cast<qreal>(i), 1};
+                    });
+                }
+            }
+        } else {
+            QBENCHMARK {
+                for (auto i = 0; i < 1000; ++i) {
+                    auto points = object.points.value();
+                    points[i] = {static_cast<qreal>(i), 1};
+                    object.points.setValue(std::move(points));
+                }
+            }
+        }
+
+        QCOMPARE_GE(receivedCount, 1000);
+    }
+
+    void testChangeDetection_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("equality") << makeChangeDetectionTest<&NObjectComparison::equality>();
+        QTest::newRow("identity") << makeChangeDetectionTest<&NObjectComparison::identity>();
+        QTest::newRow("fuzzy")    << makeChangeDetectionTest<&NObjectComparison::fuzzy>();
+        QTest::newRow("hash")     << makeChangeDetectionTest<&NObjectComparison::hash>();
+        QTest::newRow("always")   << makeChangeDetectionTest<&NObjectComparison::always>();
+    }
+
+    void testChangeDetection()              { runFeatureTest(); }
+
+    void testBatchedNotifications()
+    {
+        auto object = NObjectBatch{};
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        object.p00.connect(&context, [&received](int value) { received.append(value); });
+        object.p01.connect(&context, [&received](int value) { received.append(value); });
+
+        {
+            const auto outer = object.batchNotifications();
+
+            object.p01 = 1;
+            object.p00 = 1;
+
+            {
+                const auto inner = object.batchNotifications();
+                object.p00 = 2;
+            }
+
+            QVERIFY(received.isEmpty());
+        }
+
+        QCOMPARE(received, (QList<int>{2, 1}));
+
+        object.p00 = 3;
+
+        QCOMPARE(received, (QList<int>{2, 1, 3}));
+    }
+
+    void testBatchedNotificationsDestroyingObject()
+    {
+        auto object = std::make_unique<NObjectBatch>();
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        object->p00.connect(&context, [&object, &received](int value) {
+            received.append(value);
+            object.reset();
+        });
+
+        object->p01.connect(&context, [&received](int value) { received.append(value); });
+
+        {
+            const auto batch = object->batchNotifications();
+
+            object->p00 = 1;
+            object->p01 = 2;
+        }
+
+        QCOMPARE(received, (QList<int>{1}));
+        QVERIFY(object == nullptr);
+    }
+
+    void testBatchedNotificationCost_data()
+    {
+        QTest::addColumn<bool>("batched");
+
+        QTest::newRow("immediate") << false;
+        QTest::newRow("batched")   << true;
+    }
+
+    /// Each receiver recomputes a sum of all properties on any change,
+    /// which is a typical pattern for derived state.
+    ///
+    void testBatchedNotificationCost()
+    {
+        const QFETCH(bool, batched);
+
+        auto object = NObjectBatch{};
+        auto context = QObject{};
+        auto recomputeCount = 0;
+        auto sum = 0;
+
+        const auto recompute = [&object, &recomputeCount, &sum] {
+            ++recomputeCount;
+            sum = 0;
+            object.forEachProperty([&sum](const auto &property) { sum += property(); });
+        };
+
+        object.forEachProperty([&context, &recompute](auto &property) {
+            property.connect(&context, recompute);
+        });
+
+        auto value = 0;
+
+        // Several updates of all properties, as they happen when processing
+        // a burst of messages from some server, or some sensor.
+        const auto updateAll = [&object, &value] {
+            for (auto i = 0; i < 10; ++i) {
+                ++value;
+                object.forEachProperty([value](auto &property) { property = value; });
+            }
+        };
+
+        QBENCHMARK {
+            if (batched) {
+                const auto batch = object.batchNotifications();
+                updateAll();
+            } else {
+                updateAll();
+            }
+        }
+
+        QCOMPARE(sum, 20 * value);
+        QCOMPARE_GE(recomputeCount, batched ? 20 : 20 * 10);
+    }
+
+    void testCoalescedNotifications()
+    {
+        auto object = NObjectCoalesce{};
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        object.coalesced.connect(&context, [&received](int value) { received.append(value); });
+
+        for (auto i = 1; i <= 100; ++i)
+            object.coalesced = i;
+
+        QVERIFY(received.isEmpty());
+
+        QCoreApplication::processEvents();
+        QCOMPARE(received, QList<int>{100});
+
+        QCoreApplication::processEvents();
+        QCOMPARE(received, QList<int>{100});
+
+        object.coalesced = 101;
+        QCoreApplication::processEvents();
+        QCOMPARE(received, (QList<int>{100, 101}));
+    }
+
+    void testCoalescedNotificationCost_data()
+    {
+        QTest::addColumn<bool>("coalesced");
+
+        QTest::newRow("immediate") << false;
+        QTest::newRow("coalesced") << true;
+    }
+
+    /// Changes a property 1000 times per event loop iteration.
+    ///
+    void testCoalescedNotificationCost()
+    {
+        const QFETCH(bool, coalesced);
+
+        if (coalesced)
+            benchmarkCoalescedNotifications<&NObjectCoalesce::coalesced>();
+        else
+            benchmarkCoalescedNotifications<&NObjectCoalesce::immediate>();
+    }
+
+    void testThrottledNotifications()
+    {
+        auto object = NObjectThrottle{};
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        object.throttled.connect(&context, [&received](int value) { received.append(value); });
+
+        for (auto i = 1; i <= 100; ++i)
+            object.throttled = i;
+
+        QCOMPARE(received, QList<int>{1});
+
+        QTRY_COMPARE(received, (QList<int>{1, 100}));
+
+        QTest::qWait(static_cast<int>(2 * NObjectThrottle::interval.count()));
+        QCOMPARE(received, (QList<int>{1, 100}));
+
+        object.throttled = 101;
+        QCOMPARE(received, (QList<int>{1, 100, 101}));
+    }
+
+    void testThrottledNotificationsDestroyingObject()
+    {
+        auto first = std::make_unique<NObjectThrottle>();
+        auto second = std::make_unique<NObjectThrottle>();
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        first->throttled.connect(&context, [&second, &received](int value) {
+            received.append(value);
+
+            if (value == 2)
+                second.reset();
+        });
+
+        second->throttled.connect(&context, [&received](int value) { received.append(-value); });
+
+        first->throttled = 1;
+        second->throttled = 1;
+        first->throttled = 2;
+        second->throttled = 2;
+
+        QCOMPARE(received, (QList<int>{1, -1}));
+
+        // Both trailing notifications are due when the timer fires. The first
+        // one's receiver destroys the second object before it is processed.
+        QTest::qSleep(static_cast<int>(2 * NObjectThrottle::interval.count()));
+
+        QTRY_COMPARE(received, (QList<int>{1, -1, 2}));
+        QVERIFY(second == nullptr);
+
+        QTest::qWait(static_cast<int>(2 * NObjectThrottle::interval.count()));
+        QCOMPARE(received, (QList<int>{1, -1, 2}));
+    }
+
+    void testThrottledNotificationsInThread()
+    {
+        // The throttle of each thread owns a timer. It must be destroyed by its thread,
+        // before the thread's event dispatcher is gone. Otherwise Qt warns about it.
+        QTest::failOnWarning(QRegularExpression{u".*"_qs});
+
+        auto received = QList<int>{};
+        const auto thread = std::unique_ptr<QThread>{QThread::create([&received] {
+            auto object = NObjectThrottle{};
+            auto loop = QEventLoop{};
+
+            object.throttled.connect(&loop, [&received, &loop](int value) {
+                received.append(value);
+
+                if (value == 100)
+                    loop.quit();
+            });
+
+            for (auto i = 1; i <= 100; ++i)
+                object.throttled = i;
+
+            loop.exec();
+        })};
+
+        thread->start();
+        QVERIFY(thread->wait());
+
+        QCOMPARE(received, (QList<int>{1, 100}));
+    }
+
+    void testThrottledNotificationCost_data()
+    {
+        QTest::addColumn<bool>("throttled");
+
+        QTest::newRow("immediate") << false;
+        QTest::newRow("throttled") << true;
+    }
+
+    /// Changes a property at 10 kHz for 200 ms, and reports the time spent by
+    /// a receiver that does some expensive work for each notification.
+    ///
+    void testThrottledNotificationCost()
+    {
+        const QFETCH(bool, throttled);
+
+        if (throttled)
+            benchmarkThrottledNotifications<&NObjectThrottle::throttled>();
+        else
+            benchmarkThrottledNotifications<&NObjectThrottle::immediate>();
+    }
+
+    void testAtomicProperties()
+    {
+        auto object = NObjectAtomic{};
+        auto context = QObject{};
+        auto received = QList<qint64>{};
+
+        object.counter.connect(&context, [&received](qint64 value) { received.append(value); });
+
+        object.counter = 1;
+        object.counter = 1;
+        object.counter.modify([](qint64 &value) { value += 2; });
+        object.counter.modify([](qint64 &) { return false; });
+
+        QCOMPARE(object.counter(), qint64{3});
+        QCOMPARE(received, (QList<qint64>{1, 3}));
+    }
+
+    void testAtomicPropertyContention_data()
+    {
+        QTest::addColumn<int>("readerCount");
+
+        QTest::newRow("1 reader")   << 1;
+        QTest::newRow("4 readers")  << 4;
+        QTest::newRow("16 readers") << 16;
+    }
+
+    /// Writes atomic properties, while other threads continuously read them.
+    /// The readers check that they never observe a partially written value.
+    ///
+    void testAtomicPropertyContention()
+    {
+        const QFETCH(int, readerCount);
+
+        auto object = NObjectAtomic{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+        auto tornReadCount = std::atomic<int>{0};
+        auto stopped = std::atomic<bool>{false};
+        auto readers = std::vector<std::thread>{};
+        auto value = 0;
+
+        object.position.connect(&context, [&receivedCount] { ++receivedCount; });
+
+        for (auto i = 0; i < readerCount; ++i) {
+            readers.emplace_back([&object, &tornReadCount, &stopped] {
+                while (!stopped.load(std::memory_order_relaxed)) {
+                    const auto position = object.position();
+                    const auto counter = object.counter();
+
+                    if (position.x() != position.y() || counter < 0)
+                        tornReadCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                ++value;
+                object.position = QPoint(value, value);
+                object.counter = value;
+            }
+        }
+
+        stopped.store(true, std::memory_order_relaxed);
+
+        for (auto &reader: readers)
+            reader.join();
+
+        QCOMPARE(tornReadCount.load(), 0);
+        QCOMPARE(receivedCount, value);
+    }
+
+    void testSnapshots()
+    {
+        auto object = NObjectSnapshot{};
+
+        QVERIFY(object.snapshot() == nullptr);
+
+        object.setGeometry(1);
+        QVERIFY(object.snapshot() == nullptr);
+
+        object.enableSnapshots();
+
+        const auto first = object.snapshot();
+        QVERIFY(first != nullptr);
+        QCOMPARE(first->value<&NObjectSnapshot::x>(),      1.0);
+        QCOMPARE(first->value<&NObjectSnapshot::height>(), 1.0);
+
+        object.setGeometry(2);
+
+        const auto second = object.snapshot();
+        QVERIFY(second != first);
+        QCOMPARE(second->value<&NObjectSnapshot::x>(),      2.0);
+        QCOMPARE(second->value<&NObjectSnapshot::height>(), 2.0);
+
+        // Snapshots are immutable, and live as long as their readers
+        QCOMPARE(first->value<&NObjectSnapshot::x>(), 1.0);
+
+        // Changes without batch are published immediately
+        object.x = 3;
+
+        const auto third = object.snapshot();
+        QVERIFY(third != second);
+        QCOMPARE(third->value<&NObjectSnapshot::x>(), 3.0);
+        QCOMPARE(third->value<&NObjectSnapshot::y>(), 2.0);
+
+        QCOMPARE(second->value<&NObjectSnapshot::x>(), 2.0);
+
+        // Writes that don't change anything publish nothing
+        object.x = 3;
+        QVERIFY(object.snapshot() == third);
+
+        // Values that are not trivially copyable are stored too
+        object.title = u"fourth"_qs;
+
+        const auto fourth = object.snapshot();
+        QVERIFY(fourth != third);
+        QCOMPARE(fourth->value<&NObjectSnapshot::title>(), u"fourth"_qs);
+        QCOMPARE(fourth->value<&NObjectSnapshot::x>(), 3.0);
+        QCOMPARE(third->value<&NObjectSnapshot::title>(), QString{});
+
+        object.publishSnapshot();
+        QVERIFY(object.snapshot() != fourth);
+        QCOMPARE(object.snapshot()->value<&NObjectSnapshot::title>(), u"fourth"_qs);
+    }
+
+    void testSnapshotReadCost_data()
+    {
+        QTest::addColumn<bool>("snapshots");
+
+        QTest::newRow("mutex")     << false;
+        QTest::newRow("snapshots") << true;
+    }
+
+    /// Reads a consistent geometry, while another thread keeps changing it.
+    /// The baseline protects a plain struct by a mutex.
+    ///
+    void testSnapshotReadCost()
+    {
+        const QFETCH(bool, snapshots);
+
+        if (snapshots)
+            benchmarkSnapshotReads();
+        else
+            benchmarkMutexReads();
+    }
+
+    void testPostedWrites()
+    {
+        auto object = NObjectPostedWrites{};
+        auto context = QObject{};
+        auto received = QList<int>{};
+
+        object.progress.connect(&context, [&received](int value) { received.append(value); });
+
+        auto worker = std::thread{[&object] {
+            for (auto i = 1; i <= 100; ++i)
+                object.progress.post(i);
+
+            object.status.post(u"done"_qs);
+        }};
+
+        worker.join();
+
+        QCOMPARE(object.progress(), 0);
+        QVERIFY(received.isEmpty());
+
+        QCoreApplication::sendPostedEvents(&object);
+
+        QCOMPARE(object.progress(), 100);
+        QCOMPARE(object.status(), u"done"_qs);
+        QCOMPARE(received, QList<int>{100});
+
+        // The worker has finished before its writes were released, and their pool
+        // with them. Writes posted by this thread reuse the storage it releases.
+        for (auto i = 101; i <= 102; ++i) {
+            object.progress.post(i);
+            QCoreApplication::sendPostedEvents(&object);
+        }
+
+        QCOMPARE(object.progress(), 102);
+        QCOMPARE(received, (QList<int>{100, 101, 102}));
+    }
+
+    void testPostedWriteThroughput_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("post")         << makeTestFunction<&benchmarkPostedWrites<WriteMethod::Post>>();
+        QTest::newRow("invokeMethod") << makeTestFunction<&benchmarkPostedWrites<WriteMethod::InvokeMethod>>();
+        QTest::newRow("metaProperty") << makeTestFunction<&benchmarkPostedWrites<WriteMethod::MetaProperty>>();
+    }
+
+    /// Four worker threads write 10'000 values each into an object of the test
+    /// thread, which then applies them. Divide by 40'000 for the cost per write.
+    ///
+    void testPostedWriteThroughput()        { runFeatureTest(); }
+
+    void testChangeTracking()
+    {
+        auto object = NObjectTracked{};
+
+        object.p1 = 1;
+        QVERIFY(!object.isChangeTrackingEnabled());
+        QVERIFY(object.changedProperties().isEmpty());
+
+        object.enableChangeTracking();
+        QVERIFY(object.isChangeTrackingEnabled());
+        QVERIFY(object.changedProperties().isEmpty());
+
+        object.p1 = 1; // unchanged
+        object.p2 = 2;
+        object.p7 = 7;
+        object.p0.modify([](int &value) { value = 10; });
+
+        auto changed = QList<int>{};
+        object.changedProperties().forEach([&changed](int index) { changed.append(index); });
+
+        QCOMPARE(object.changedProperties().count(), 3);
+        QCOMPARE(changed, (QList<int>{0, 2, 7}));
+
+        object.clearChangedProperties();
+        QVERIFY(object.changedProperties().isEmpty());
+    }
+
+    void testIncrementalSync_data()
+    {
+        QTest::addColumn<bool>("tracking");
+
+        QTest::newRow("full")    << false;
+        QTest::newRow("tracked") << true;
+    }
+
+    /// Synchronizes 100'000 objects with some storage, after 1% of them got changed.
+    /// Without tracking each property must be serialized. With tracking only those
+    /// that have changed, and each unchanged object just costs a check of its bits.
+    ///
+    void testIncrementalSync()
+    {
+        const QFETCH(bool, tracking);
+
+        constexpr auto objectCount = 100'000;
+        constexpr auto churnCount = objectCount / 100;
+
+        auto objects = std::vector<std::unique_ptr<NObjectTracked>>{};
+        objects.reserve(objectCount);
+
+        for (auto i = 0; i < objectCount; ++i) {
+            objects.emplace_back(std::make_unique<NObjectTracked>());
+
+            if (tracking)
+                objects.back()->enableChangeTracking();
+        }
+
+        const auto metaObject = &NObjectTracked::staticMetaObject;
+        const auto propertyOffset = metaObject->propertyOffset();
+        const auto propertyCount = metaObject->propertyCount() - propertyOffset;
+
+        auto serializedCount = qint64{0};
+        auto checksum = qint64{0};
+        auto round = 0;
+
+        const auto serialize = [&](const NObjectTracked *object, int index) {
+            checksum += metaObject->property(propertyOffset + index).read(object).toInt();
+            ++serializedCount;
+        };
+
+        QBENCHMARK {
+            ++round;
+
+            for (auto i = 0; i < churnCount; ++i)
+                objects[static_cast<std::size_t>((round * 7919 + i * 97) % objectCount)]->p3 = round;
+
+            for (const auto &object: objects) {
+                if (tracking) {
+                    object->changedProperties().forEach([&serialize, &object](int index) {
+                        serialize(object.get(), index);
+                    });
+
+                    object->clearChangedProperties();
+                } else {
+                    for (auto index = 0; index < propertyCount; ++index)
+                        serialize(object.get(), index);
+                }
+            }
+        }
+
+        QVERIFY(serializedCount > 0);
+        QVERIFY(checksum > 0);
+    }
+
+    void testColumnarProperties()
+    {
+        using Column = decltype(NObjectColumnar::weight);
+
+        const auto initialSize = Column::column().size();
+        auto context = QObject{};
+        auto received = QList<qreal>{};
+
+        {
+            auto first  = NObjectColumnar{};
+            auto second = std::make_unique<NObjectColumnar>();
+            auto third  = NObjectColumnar{};
+
+            QCOMPARE(Column::column().size(), initialSize + 3);
+
+            third.weight.connect(&context, [&received](qreal value) { received.append(value); });
+
+            first.weight = 2;
+            third.weight = 3;
+            second.reset();
+
+            QCOMPARE(Column::column().size(), initialSize + 2);
+            QCOMPARE(first.weight(), 2.0);
+            QCOMPARE(third.weight(), 3.0);
+            QCOMPARE(received, QList<qreal>{3.0});
+
+            third.setProperty("weight", 4.0);
+            QCOMPARE(third.property("weight").value<qreal>(), 4.0);
+            QCOMPARE(received, (QList<qreal>{3.0, 4.0}));
+        }
+
+        QCOMPARE(Column::column().size(), initialSize);
+    }
+
+    void testColumnarStorage_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("inline/scan")     << makeTestFunction<&benchmarkColumnarStorage<NObjectInline,   true>>();
+        QTest::newRow("columnar/scan")   << makeTestFunction<&benchmarkColumnarStorage<NObjectColumnar, true>>();
+        QTest::newRow("inline/access")   << makeTestFunction<&benchmarkColumnarStorage<NObjectInline,   false>>();
+        QTest::newRow("columnar/access") << makeTestFunction<&benchmarkColumnarStorage<NObjectColumnar, false>>();
+    }
+
+    /// Either sums up a property of 100'000 objects, or updates it for each object.
+    ///
+    void testColumnarStorage()              { runFeatureTest(); }
+
+    void testBulkQueries()
+    {
+        auto storage = std::vector<std::unique_ptr<NObjectReading>>{};
+        auto objects = std::vector<NObjectReading *>{};
+
+        for (auto i = 0; i < 21; ++i) {
+            objects.emplace_back(storage.emplace_back(std::make_unique<NObjectReading>()).get());
+            objects.back()->count = i;
+            objects.back()->value = i * 0.5;
+        }
+
+        const auto counts = nproperty::BulkQuery<&NObjectReading::count>{objects};
+        const auto values = nproperty::BulkQuery<&NObjectReading::value>{objects};
+
+        QCOMPARE(counts.sum(), qint64{210});
+        QCOMPARE(counts.minimum(), 0);
+        QCOMPARE(counts.maximum(), 20);
+        QCOMPARE(values.maximum(), 10.0);
+        QVERIFY(counts.greaterThan(17) == (std::vector{objects[18], objects[19], objects[20]}));
+        QVERIFY(values.greaterThan(9.0) == (std::vector{objects[19], objects[20]}));
+
+        // The gathered values are refreshed by change notifications.
+        objects[3]->count = 100;
+        objects[5]->value = -1;
+
+        QCOMPARE(counts.sum(), qint64{307});
+        QCOMPARE(counts.maximum(), 100);
+        QCOMPARE(values.minimum(), -1.0);
+        QVERIFY(counts.greaterThan(17) == (std::vector{objects[3], objects[18], objects[19], objects[20]}));
+    }
+
+    void testBulkQueryCost_data()
+    {
+        QTest::addColumn<bool>("bulkQuery");
+
+        QTest::newRow("metaProperty") << false;
+        QTest::newRow("bulkQuery")    << true;
+    }
+
+    /// Computes the sum, minimum and maximum of a property over 100'000 objects,
+    /// and counts the objects exceeding a threshold, after 1% of them changed.
+    ///
+    void testBulkQueryCost()
+    {
+        const QFETCH(bool, bulkQuery);
+
+        constexpr auto objectCount = 100'000;
+        constexpr auto churnCount = objectCount / 100;
+        constexpr auto threshold = 50.0;
+
+        auto storage = std::vector<std::unique_ptr<NObjectReading>>{};
+        auto objects = std::vector<NObjectReading *>{};
+
+        for (auto i = 0; i < objectCount; ++i) {
+            objects.emplace_back(storage.emplace_back(std::make_unique<NObjectReading>()).get());
+            objects.back()->value = (i * 7919) % 100;
+        }
+
+        const auto metaObject = &NObjectReading::staticMetaObject;
+        const auto property = metaObject->property(metaObject->indexOfProperty("value"));
+        const auto query = bulkQuery ? std::make_unique<nproperty::BulkQuery<&NObjectReading::value>>(objects)
+                                     : nullptr;
+        auto round = 0;
+        auto matches = std::size_t{0};
+
+        QBENCHMARK {
+            ++round;
+
+            for (auto i = 0; i < churnCount; ++i)
+                objects[static_cast<std::size_t>((round * 7919 + i * 97) % objectCount)]->value = round % 100;
+
+            auto sum = 0.0;
+            auto minimum = std::numeric_limits<double>::max();
+            auto maximum = std::numeric_limits<double>::lowest();
+
+            if (query) {
+                sum = query->sum();
+                minimum = query->minimum();
+                maximum = query->maximum();
+                matches = query->greaterThan(threshold).size();
+            } else {
+                matches = 0;
+
+                for (const auto object: objects) {
+                    const auto value = property.read(object).toDouble();
+
+                    sum += value;
+                    minimum = std::min(minimum, value);
+                    maximum = std::max(maximum, value);
+
+                    if (value > threshold)
+                        ++matches;
+                }
+            }
+
+            QCOMPARE_GE(sum, 0.0);
+            QCOMPARE_LE(minimum, maximum);
+        }
+
+        QCOMPARE_GT(matches, 0u);
+    }
+
+    void testPropertyIndexes()
+    {
+        auto storage = std::vector<std::unique_ptr<NObjectRecord>>{};
+        auto objects = std::vector<NObjectRecord *>{};
+
+        for (auto i = 0; i < 10; ++i) {
+            objects.emplace_back(storage.emplace_back(std::make_unique<NObjectRecord>()).get());
+            objects.back()->id = i;
+            objects.back()->name = (i % 2 ? u"odd"_qs : u"even"_qs);
+        }
+
+        const auto ids = nproperty::OrderedIndex<&NObjectRecord::id>{objects};
+        const auto names = nproperty::HashIndex<&NObjectRecord::name>{objects};
+
+        QCOMPARE(ids.size(), std::size_t{10});
+        QCOMPARE(ids.value(3), objects[3]);
+        QCOMPARE(ids.value(10), nullptr);
+        QCOMPARE(names.keyCount(), std::size_t{2});
+        QCOMPARE(names.find(u"odd"_qs).size(), std::size_t{5});
+
+        objects[3]->id = 30;
+        objects[3]->name = u"changed"_qs;
+
+        QCOMPARE(ids.value(3), nullptr);
+        QCOMPARE(ids.value(30), objects[3]);
+        QCOMPARE(names.find(u"odd"_qs).size(), std::size_t{4});
+        QCOMPARE(names.value(u"changed"_qs), objects[3]);
+
+        auto range = QList<int>{};
+        ids.forEachInRange(5, 31, [&range](NObjectRecord *object) { range.append(object->id()); });
+        QCOMPARE(range, (QList<int>{5, 6, 7, 8, 9, 30}));
+
+        storage[5].reset();
+        QCOMPARE(ids.size(), std::size_t{9});
+        QCOMPARE(ids.value(5), nullptr);
+        QCOMPARE(names.find(u"odd"_qs).size(), std::size_t{3});
+    }
+
+    void testPropertyIndexCost_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("scan/lookup")    << makeTestFunction<&benchmarkPropertyIndex<void, true>>();
+        QTest::newRow("hash/lookup")    << makeTestFunction<&benchmarkPropertyIndex<nproperty::HashIndex<&NObjectRecord::id>, true>>();
+        QTest::newRow("ordered/lookup") << makeTestFunction<&benchmarkPropertyIndex<nproperty::OrderedIndex<&NObjectRecord::id>, true>>();
+        QTest::newRow("none/churn")     << makeTestFunction<&benchmarkPropertyIndex<void, false>>();
+        QTest::newRow("hash/churn")     << makeTestFunction<&benchmarkPropertyIndex<nproperty::HashIndex<&NObjectRecord::id>, false>>();
+        QTest::newRow("ordered/churn")  << makeTestFunction<&benchmarkPropertyIndex<nproperty::OrderedIndex<&NObjectRecord::id>, false>>();
+    }
+
+    /// Either looks up 1000 of 100'000 objects by their id, or changes
+    /// the id of 1% of them, while the index is kept up-to-date.
+    ///
+    void testPropertyIndexCost()            { runFeatureTest(); }
+
+    void testComputedProperties()
+    {
+        auto object = NObjectComputed{};
+        QCOMPARE(object.areaComputations, 0);
+
+        QCOMPARE(object.area(), 6);
+        QCOMPARE(object.area(), 6);
+        QCOMPARE(object.areaComputations, 1);
+
+        object.title = u"unrelated"_qs;
+        QCOMPARE(object.area(), 6);
+        QCOMPARE(object.areaComputations, 1);
+
+        object.width = 4;
+        QCOMPARE(object.areaComputations, 1);
+        QCOMPARE(object.area(), 12);
+        QCOMPARE(object.areaComputations, 2);
+
+        const auto metaObject = object.metaObject();
+        const auto property = metaObject->property(metaObject->indexOfProperty("area"));
+        QVERIFY(property.hasNotifySignal());
+        QVERIFY(!property.isWritable());
+        QCOMPARE(property.read(&object).toInt(), 12);
+        QVERIFY(object.large());
+
+        auto context = QObject{};
+        auto areas = QList<int>{};
+        auto large = QList<bool>{};
+
+        object.area .connect(&context, [&areas](int value) { areas.append(value); });
+        object.large.connect(&context, [&large](bool value) { large.append(value); });
+
+        object.height = 2;  // area 8, no longer large
+        object.width  = 8;  // area 16, large again
+        object.height = 2;  // unchanged
+        object.width  = 16; // area 32, still large
+        object.height = 1;  // area 16, still large
+
+        QCOMPARE(areas, (QList<int>{8, 16, 32, 16}));
+        QCOMPARE(large, (QList<bool>{false, true}));
+        QCOMPARE(object.areaComputations, 6);
+    }
+
+    void testComputedPropertyCost_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("connected/create")    << makeTestFunction<&benchmarkComputedProperties<NObjectConnected, ComputedOperation::Create>>();
+        QTest::newRow("computed/create")     << makeTestFunction<&benchmarkComputedProperties<NObjectComputed,  ComputedOperation::Create>>();
+        QTest::newRow("connected/write")     << makeTestFunction<&benchmarkComputedProperties<NObjectConnected, ComputedOperation::Write>>();
+        QTest::newRow("computed/write")      << makeTestFunction<&benchmarkComputedProperties<NObjectComputed,  ComputedOperation::Write>>();
+        QTest::newRow("connected/writeRead") << makeTestFunction<&benchmarkComputedProperties<NObjectConnected, ComputedOperation::WriteRead>>();
+        QTest::newRow("computed/writeRead")  << makeTestFunction<&benchmarkComputedProperties<NObjectComputed,  ComputedOperation::WriteRead>>();
+    }
+
+    /// Compares computed properties with properties updated by signal connections: When
+    /// creating objects, when writing dependencies without reading the result, and when
+    /// reading the result after each write. Divide by 10'000 for the cost per operation.
+    ///
+    void testComputedPropertyCost()         { runFeatureTest(); }
+
+    void testGlitchFreePropagation()
+    {
+        auto object = NObjectDiamond{};
+        auto context = QObject{};
+        auto sinks = QList<int>{};
+        auto inconsistentCount = 0;
+
+        QCOMPARE(object.sink(), 4);
+        QCOMPARE(object.sinkComputations, 1);
+
+        const auto check = [&object, &inconsistentCount] {
+            if (!object.isConsistent())
+                ++inconsistentCount;
+        };
+
+        object.input.connect(&context, check);
+        object.left .connect(&context, check);
+        object.right.connect(&context, check);
+        object.sink .connect(&context, [&sinks, &check](int value) { sinks.append(value); check(); });
+
+        for (auto i = 2; i <= 5; ++i)
+            object.input = i;
+
+        QCOMPARE(sinks, (QList<int>{7, 10, 13, 16}));
+        QCOMPARE(object.sinkComputations, 5);
+        QCOMPARE(inconsistentCount, 0);
+    }
+
+    void testReversedPropagation()
+    {
+        auto object = NObjectReversedDiamond{};
+        auto context = QObject{};
+        auto sinks = QList<int>{};
+        auto inconsistentCount = 0;
+
+        QCOMPARE(object.sink(),  1);
+        QCOMPARE(object.left(),  2);
+        QCOMPARE(object.right(), 2);
+
+        object.sink.connect(&context, [&object, &sinks, &inconsistentCount](int value) {
+            sinks.append(value);
+
+            if (!object.isConsistent())
+                ++inconsistentCount;
+        });
+
+        // The first update computes the sink before left and right, from their stale
+        // values, as only then it reads them. It must be computed again after them.
+        for (auto i = 2; i <= 5; ++i)
+            object.input = i;
+
+        QCOMPARE(sinks, (QList<int>{2, 10, 13, 16}));
+        QCOMPARE(inconsistentCount, 0);
+
+        // The order is shared by all objects of the class, and receivers are notified in
+        // that order too: Those of the sink after those of the properties it has read.
+        auto other = NObjectReversedDiamond{};
+        auto notified = QList<QString>{};
+
+        other.left .connect(&context, [&notified] { notified.append(u"left"_qs); });
+        other.right.connect(&context, [&notified] { notified.append(u"right"_qs); });
+        other.sink .connect(&context, [&notified] { notified.append(u"sink"_qs); });
+
+        other.input = 3;
+
+        QCOMPARE(notified, (QList<QString>{u"left"_qs, u"right"_qs, u"sink"_qs}));
+        QVERIFY(other.isConsistent());
+    }
+
+    void testPropagationScaling_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("chain/10")      << makeTestFunction<&benchmarkPropagation<NObjectChain10>>();
+        QTest::newRow("chain/100")     << makeTestFunction<&benchmarkPropagation<NObjectChain100>>();
+        QTest::newRow("chain/1000")    << makeTestFunction<&benchmarkPropagation<NObjectChain1000>>();
+        QTest::newRow("diamonds/10")   << makeTestFunction<&benchmarkPropagation<NObjectDiamonds10>>();
+        QTest::newRow("diamonds/100")  << makeTestFunction<&benchmarkPropagation<NObjectDiamonds100>>();
+        QTest::newRow("diamonds/1000") << makeTestFunction<&benchmarkPropagation<NObjectDiamonds1000>>();
+    }
+
+    /// Changes the input of dependency graphs, which then get propagated to a receiver
+    /// of the graph's sink. Each computed property must be computed exactly once per
+    /// change. The cost should grow linearly, also for stacked diamonds.
+    ///
+    void testPropagationScaling()           { runFeatureTest(); }
+
+    void testParallelEvaluation()
+    {
+        constexpr auto objectCount = 100;
+
+        auto pool = QThreadPool{};
+        pool.setMaxThreadCount(4);
+
+        auto objects = std::vector<std::unique_ptr<NObjectStatistics>>{};
+        auto context = QObject{};
+        auto received = QList<quint32>(objectCount);
+        auto receivedCount = 0;
+
+        for (auto i = 0; i < objectCount; ++i) {
+            auto &object = objects.emplace_back(std::make_unique<NObjectStatistics>());
+            object->summary.connect(&context, [&received, &receivedCount, i](quint32 value) {
+                received[i] = value;
+                ++receivedCount;
+            });
+        }
+
+        {
+            auto evaluation = nproperty::ParallelEvaluation{&pool};
+
+            for (auto i = 0; i < objectCount; ++i) {
+                const auto &object = objects[static_cast<std::size_t>(i)];
+                evaluation.add(object.get());
+                object->input = i + 1;
+            }
+
+            QCOMPARE(receivedCount, 0);
+            evaluation.run();
+        }
+
+        QCOMPARE(receivedCount, objectCount);
+
+        for (auto i = 0; i < objectCount; ++i) {
+            const auto expected = NObjectStatistics::mix(NObjectStatistics::mix(static_cast<quint32>(i + 1)));
+
+            QCOMPARE(received[i], expected);
+            QCOMPARE(objects[static_cast<std::size_t>(i)]->summary(), expected);
+        }
+
+        // Without evaluation the object gets updated immediately again.
+        objects.front()->input = 0;
+
+        QCOMPARE(receivedCount, objectCount + 1);
+        QCOMPARE(received.front(), quint32{0});
+    }
+
+    /// Computed properties without receivers are computed by the threads of the
+    /// evaluation too, and not by the object's thread when they are read next.
+    ///
+    void testParallelEvaluationWithoutReceivers()
+    {
+        constexpr auto objectCount = 20;
+
+        auto pool = QThreadPool{};
+        pool.setMaxThreadCount(4);
+
+        auto objects = std::vector<std::unique_ptr<NObjectComputed>>{};
+
+        for (auto i = 0; i < objectCount; ++i) {
+            const auto &object = objects.emplace_back(std::make_unique<NObjectComputed>());
+            QCOMPARE(object->area(), 6);
+            QCOMPARE(object->areaComputations, 1);
+        }
+
+        {
+            auto evaluation = nproperty::ParallelEvaluation{&pool};
+
+            for (auto i = 0; i < objectCount; ++i) {
+                const auto &object = objects[static_cast<std::size_t>(i)];
+                evaluation.add(object.get());
+                object->width = i + 3;
+            }
+
+            for (const auto &object: objects)
+                QCOMPARE(object->areaComputations, 1);
+
+            evaluation.run();
+        }
+
+        for (auto i = 0; i < objectCount; ++i) {
+            const auto &object = objects[static_cast<std::size_t>(i)];
+
+            QCOMPARE(object->areaComputations, 2);
+            QCOMPARE(object->area(), (i + 3) * 3);
+            QCOMPARE(object->areaComputations, 2);
+        }
+    }
+
+    void testParallelEvaluationScaling_data()
+    {
+        QTest::addColumn<int>("threadCount");
+
+        for (auto threadCount = 1; threadCount <= QThread::idealThreadCount(); threadCount *= 2)
+            QTest::addRow("%d threads", threadCount) << threadCount;
+    }
+
+    /// Changes the input of 1000 objects, and then updates their expensive computed
+    /// properties on a thread pool with increasing number of threads. Ideally the cost
+    /// drops with each additional core.
+    ///
+    void testParallelEvaluationScaling()
+    {
+        constexpr auto objectCount = 1000;
+
+        const QFETCH(int, threadCount);
+
+        auto pool = QThreadPool{};
+        pool.setMaxThreadCount(threadCount);
+
+        auto objects = std::vector<std::unique_ptr<NObjectStatistics>>{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+        auto input = 0;
+
+        for (auto i = 0; i < objectCount; ++i) {
+            auto &object = objects.emplace_back(std::make_unique<NObjectStatistics>());
+            object->summary.connect(&context, [&receivedCount] { ++receivedCount; });
+        }
+
+        QBENCHMARK {
+            auto evaluation = nproperty::ParallelEvaluation{&pool};
+            ++input;
+
+            for (const auto &object: objects) {
+                evaluation.add(object.get());
+                object->input = input;
+            }
+
+            evaluation.run();
+        }
+
+        QCOMPARE(receivedCount, input * objectCount);
+    }
+
+    void testResetProperties()
+    {
+        auto object = NObjectReset{};
+        auto context = QObject{};
+        auto received = QList<QString>{};
+
+        object.title.connect(&context, [&received](const QString &value) { received.append(value); });
+
+        object.title = u"changed"_qs;
+        object.count = 7;
+
+        object.title.resetValue();
+        object.title.resetValue();
+
+        QCOMPARE(object.title(), u"untitled"_qs);
+        QCOMPARE(received, (QList<QString>{u"changed"_qs, u"untitled"_qs}));
+
+        const auto metaObject = object.metaObject();
+        const auto count = metaObject->property(metaObject->indexOfProperty("count"));
+
+        QVERIFY(count.isResettable());
+        QVERIFY(count.reset(&object));
+        QCOMPARE(object.count(), 1);
+
+        // Objects constructed later still start with, and reset to the same default.
+        auto other = NObjectReset{};
+        other.count = 3;
+        other.count.resetValue();
+        QCOMPARE(other.count(), 1);
+    }
+
+    /// The default value is declared with the property. So it doesn't depend on the value
+    /// the first object is constructed with, nor on the order objects are constructed in.
+    ///
+    void testResetDefaultOfFirstObject()
+    {
+        auto first = NObjectCustomReset{7};
+        auto second = NObjectCustomReset{3};
+
+        QCOMPARE(first.count(), 7);
+        QCOMPARE(second.count(), 3);
+
+        first.count.resetValue();
+        second.count.resetValue();
+
+        QCOMPARE(first.count(), 1);
+        QCOMPARE(second.count(), 1);
+
+        // Without declared default, properties reset to a value-initialized value.
+        QCOMPARE(first.plain(), 5);
+
+        first.plain.resetValue();
+        QCOMPARE(first.plain(), 0);
+    }
+
+    /// Compares the memory per object of resetable properties: NObject stores each
+    /// default value once per class, moc's `RESET` repeats them in the reset methods.
+    /// Neither costs memory per object.
+    ///
+    void testResetMemoryCost()
+    {
+        SHOW(sizeof(SObjectReset));
+        SHOW(sizeof(NObjectReset));
+        SHOW(sizeof(NObjectNoReset));
+
+        QCOMPARE(sizeof(NObjectReset::title), sizeof(QString));
+        QCOMPARE(sizeof(NObjectReset::count), sizeof(int));
+        QCOMPARE(sizeof(NObjectReset), sizeof(NObjectNoReset));
+    }
+
+    void testSparseProperties()
+    {
+        auto object = NObjectSparseSettings{};
+        auto context = QObject{};
+        auto received = QList<QString>{};
+
+        const auto metaObject = object.metaObject();
+        const auto s001 = metaObject->property(metaObject->indexOfProperty("s001"));
+
+        object.s001.connect(&context, [&received](const QString &value) { received.append(value); });
+
+        QCOMPARE(object.s000(), u"default"_qs);
+        QCOMPARE(object.s001(), u"default"_qs);
+        QCOMPARE(object.storedSparseValueCount(), std::size_t{0});
+
+        object.s001 = u"changed"_qs;
+
+        QCOMPARE(object.s000(), u"default"_qs);
+        QCOMPARE(object.s001(), u"changed"_qs);
+        QCOMPARE(s001.read(&object).toString(), u"changed"_qs);
+        QCOMPARE(object.storedSparseValueCount(), std::size_t{1});
+
+        object.s001 = u"changed"_qs;
+        QVERIFY(s001.write(&object, u"default"_qs));
+
+        QCOMPARE(object.s001(), u"default"_qs);
+        QCOMPARE(s001.read(&object).toString(), u"default"_qs);
+        QCOMPARE(object.storedSparseValueCount(), std::size_t{0});
+
+        object.s001.modify([](QString &value) { value += u'!'; });
+        object.s199.modify([](QString &) { return false; });
+
+        QCOMPARE(object.s001(), u"default!"_qs);
+        QCOMPARE(object.s199(), u"default"_qs);
+        QCOMPARE(object.storedSparseValueCount(), std::size_t{1});
+
+        QCOMPARE(received, (QList<QString>{u"changed"_qs, u"default"_qs, u"default!"_qs}));
+
+        // Other objects are not affected, and read the same default.
+        auto other = NObjectSparseSettings{};
+        QCOMPARE(other.s001(), u"default"_qs);
+        QCOMPARE(other.storedSparseValueCount(), std::size_t{0});
+    }
+
+    void testSparseDefaultOfFirstObject()
+    {
+        auto first = NObjectCustomSparse{u"first"_qs};
+        auto second = NObjectCustomSparse{u"unnamed"_qs};
+
+        QCOMPARE(first.name(), u"first"_qs);
+        QCOMPARE(first.storedSparseValueCount(), std::size_t{1});
+        QCOMPARE(second.name(), u"unnamed"_qs);
+        QCOMPARE(second.storedSparseValueCount(), std::size_t{0});
+
+        // Writing the default releases the stored value,
+        // and writing it again doesn't store anything.
+        first.name = u"unnamed"_qs;
+        QCOMPARE(first.storedSparseValueCount(), std::size_t{0});
+
+        first.name = u"unnamed"_qs;
+        first.level = 3;
+        first.level.modify([](int &) { return false; });
+        QCOMPARE(first.storedSparseValueCount(), std::size_t{0});
+
+        first.level.modify([](int &value) { ++value; });
+        QCOMPARE(first.level(), 4);
+        QCOMPARE(first.storedSparseValueCount(), std::size_t{1});
+    }
+
+    /// Creates 100'000 configuration objects with 200 settings each, and changes
+    /// five settings of each object. Reports the growth of the resident set size,
+    /// for sparse and for inline storage.
+    ///
+    void testSparseStorageMemory()
+    {
+        constexpr auto objectCount = 100'000;
+
+        if (residentSetSize() == 0)
+            QSKIP("The resident set size cannot be measured on this platform");
+
+        const auto createObjects = []<class ObjectType>(std::vector<std::unique_ptr<ObjectType>> &objects) {
+            const auto initialSize = residentSetSize();
+            objects.reserve(objectCount);
+
+            for (auto i = 0; i < objectCount; ++i) {
+                auto &object = objects.emplace_back(std::make_unique<ObjectType>());
+
+                object->s000 = QString::number(i);
+                object->s042 = QString::number(i);
+                object->s077 = QString::number(i);
+                object->s123 = QString::number(i);
+                object->s199 = QString::number(i);
+            }
+
+            return residentSetSize() - initialSize;
+        };
+
+        // Both populations are kept alive, so that the second one
+        // cannot reuse memory that was released by the first one.
+        auto sparseObjects = std::vector<std::unique_ptr<NObjectSparseSettings>>{};
+        auto inlineObjects = std::vector<std::unique_ptr<NObjectInlineSettings>>{};
+
+        const auto sparseSize = createObjects(sparseObjects);
+        const auto inlineSize = createObjects(inlineObjects);
+
+        SHOW(sizeof(NObjectSparseSettings));
+        SHOW(sizeof(NObjectInlineSettings));
+        SHOW(sparseSize / objectCount);
+        SHOW(inlineSize / objectCount);
+        SHOW(inlineSize - sparseSize);
+
+        QCOMPARE(sparseObjects.back()->s123(), QString::number(objectCount - 1));
+        QCOMPARE(sparseObjects.back()->s124(), u"default"_qs);
+        QCOMPARE_LT(sparseSize, inlineSize);
+    }
+
+    void testSignalLookupScaling_data()
+    {
+        QTest::addColumn<TestFunctionPointer>("testFunctionPointer");
+
+        QTest::newRow("10")   << makeSignalLookupTest<&NObjectSignals10::p009>();
+        QTest::newRow("100")  << makeSignalLookupTest<&NObjectSignals100::p099>();
+        QTest::newRow("1000") << makeSignalLookupTest<&NObjectSignals1000::p999>();
+    }
+
+    void testSignalLookupScaling()          { runFeatureTest(); }
+
+    void testInterfaceLookup()
+    {
+        auto object = NObjectMacro{};
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                QVERIFY(qobject_cast<experiment::InterfaceOne *>(&object));
+                QVERIFY(qobject_cast<experiment::InterfaceTwo *>(&object));
+            }
+        }
+    }
+
+private:
+    using MetaObjectPointer = const QMetaObject *;
+    using MetaObjectFactory = const QMetaObject *(*)();
+
+    /// Connects to the notification signal of the class's last property,
+    /// which is the worst case for any linear signal lookup.
+    ///
+    template<auto property>
+    static void *makeSignalLookupTest()
+    {
+        const auto testFunction = &PropertyExperiment::benchmarkSignalLookup<property>;
+        return reinterpret_cast<TestFunctionPointer>(testFunction);
+    }
+
+    template<auto property>
+    static void benchmarkSignalLookup()
+    {
+        using ObjectType = typename nproperty::detail::DataMemberType<property>::ObjectType;
+
+        auto object = ObjectType{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        const auto signal = (object.*property).notifyPointer();
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                const auto connection = connect(&object, signal, &context,
+                                                [&receivedCount] { ++receivedCount; });
+
+                QVERIFY(connection);
+                disconnect(connection);
+            }
+        }
+
+        QCOMPARE(receivedCount, 0);
+    }
+
+    template<auto property>
+    static void benchmarkCoalescedNotifications()
+    {
+        auto object = NObjectCoalesce{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+        auto value = 0;
+
+        (object.*property).connect(&context, [&receivedCount] { ++receivedCount; });
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i)
+                (object.*property) = ++value;
+
+            QCoreApplication::processEvents();
+        }
+
+        QCOMPARE_GE(receivedCount, 1);
+    }
+
+    template<auto property>
+    static void benchmarkThrottledNotifications()
+    {
+        using Clock = std::chrono::steady_clock;
 
-/// Now the constants and concepts to disable features.
-///
-template<Feature feature, class T>
-constexpr bool isImplementedFeature = (implementedFeatures<T> & feature) == feature;
+        constexpr auto period = std::chrono::microseconds{100};
+        constexpr auto updateCount = 2000;
 
-template<Feature feature, class T>
-constexpr bool isSkippedFeature = (skippedFeatures<T> & feature) == feature;
+        auto object = NObjectThrottle{};
+        auto context = QObject{};
+        auto payload = QByteArray(64 * 1024, 'x');
+        auto receiverTime = Clock::duration{};
+        auto receivedCount = 0;
+        auto receivedValue = 0;
+        auto checksum = size_t{0};
 
-template<class T, Feature feature>
-concept HasFeature = (isImplementedFeature<feature, T>
-                      && !isSkippedFeature<feature, T>);
+        (object.*property).connect(&context, [&](int value) {
+            const auto start = Clock::now();
 
-/// Finally the type specific feature configurations.
-///
-template<> constexpr auto implementedFeatures<AObjectTest>
-    = implementedFeatures<>
-      & ~UniquePropertyIds      // properties do not have their own objects with moc
-      & ~PropertyAddresses      // properties do not have their own objects with moc
-      & ~NotifyPointers         // properties do not have their own objects with moc
-    ;
+            payload[0] = static_cast<char>(value);
+            checksum ^= qHash(payload);
+            receivedValue = value;
+            ++receivedCount;
 
-template<> constexpr auto implementedFeatures<SObjectTest>
-    = implementedFeatures<>
-      & ~UniquePropertyIds      // properties do not have their own objects with moc
-      & ~PropertyAddresses      // properties do not have their own objects with moc
-      & ~NotifyPointers         // properties do not have their own objects with moc
-    ;
+            receiverTime += Clock::now() - start;
+        });
 
-template<> constexpr auto implementedFeatures<MObjectTest>
-    = implementedFeatures<>
-      & ~ClassInfo
-      & ~Interfaces
-      & ~Enumerators
-    ;
+        auto next = Clock::now();
 
-template<> constexpr auto skippedFeatures<NObjectLegacy>
-    = skippedFeatures<>
-      | SignalAddresses
-      | PropertyChanges
-      | PropertyNotifications
-      | NotifyPointers
-    ;
+        for (auto i = 1; i <= updateCount; ++i) {
+            (object.*property) = i;
 
-/// Just a tiny wrapper with simple name for the pretty verbose
-/// `!std::is_member_function_pointer_v<decltype(&T::member)>`.
-///
-template<auto pointer>
-constexpr bool isDataMember = std::is_member_pointer_v<decltype(pointer)>
-                              && !std::is_member_function_pointer_v<decltype(pointer)>;
+            for (next += period; Clock::now() < next; )
+                QCoreApplication::processEvents();
+        }
 
-/// Allow to run templated test function for different types
-///
-#define MAKE_TESTDATA(Feature) \
-    makeTestData<Feature, decltype([](auto &object) { \
-        test##Feature(object); \
-    })>()
+        // The last value always must be notified, also if throttled.
+        QTRY_COMPARE(receivedValue, updateCount);
+        QCOMPARE_LE(receivedCount, updateCount);
+        QVERIFY(checksum != 0);
 
+        const auto receiverMilliseconds = std::chrono::duration<qreal, std::milli>{receiverTime};
+        QTest::setBenchmarkResult(receiverMilliseconds.count(), QTest::WalltimeMilliseconds);
+    }
 
-/// Simply show an expression and its value.
-///
-#define SHOW(What) qInfo() << #What " =>" << (What)
+    static void benchmarkSnapshotReads()
+    {
+        auto object = NObjectSnapshot{};
+        auto inconsistentCount = 0;
 
+        object.enableSnapshots();
 
-/// Some constants for property related tests
-///
-const auto  constant1 = u"I am constant"_qs;
-const auto notifying1 = u"I am observing"_qs;
-const auto notifying2 = u"I have been changed per method"_qs;
-const auto  writable1 = u"I am modifiable"_qs;
-const auto  writable2 = u"I have been changed per setter"_qs;
-const auto  writable3 = u"I have been changed by assignment"_qs;
-const auto  metacall1 = u"I have been changed per metacall"_qs;
+        // From now on only the writer thread touches the object's properties.
+        auto stopped = std::atomic<bool>{false};
+        auto writer = std::thread{[&object, &stopped] {
+            for (auto value = 1; !stopped.load(std::memory_order_relaxed); ++value)
+                object.setGeometry(value);
+        }};
 
-const auto notifyingSpy1 = QList<QVariantList>{};
-const auto notifyingSpy2 = QList<QVariantList>{{notifying2}};
+        const auto stopWriter = qScopeGuard([&stopped, &writer] {
+            stopped.store(true, std::memory_order_relaxed);
+            writer.join();
+        });
 
-const auto writableSpy1  = QList<QVariantList>{};
-const auto writableSpy2  = QList<QVariantList>{{writable2}};
-const auto writableSpy3  = QList<QVariantList>{{writable2}, {metacall1}};
-const auto writableSpy4  = QList<QVariantList>{{writable2}, {metacall1}, {writable3}};
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                const auto snapshot = object.snapshot();
+                const auto x = snapshot->value<&NObjectSnapshot::x>();
+
+                if (snapshot->value<&NObjectSnapshot::y>()      != x
+                    || snapshot->value<&NObjectSnapshot::width>()  != x
+                    || snapshot->value<&NObjectSnapshot::height>() != x)
+                    ++inconsistentCount;
+            }
+        }
 
-/// The property experiment is implemented as Qt Test suite.
-///
-class PropertyExperiment: public QObject
-{
-    Q_OBJECT
+        QCOMPARE(inconsistentCount, 0);
+    }
 
-    /// --------------------------------------------------------------------------------------------
-    /// Normally one would just make the type under test template argument of this class.
-    /// Unfortunately moc doesn't support template types. Therefore a different approach
-    /// is needed here to provide (almost) identical tests for each property system.
-    ///
-    /// The actual tests are implemented in template functions. The _data() slots of each
-    /// test simply push a type erased delegate to the test data set, which then is run
-    /// by the actual test slot. Sounds complicated, but isn't too much. Foremost it's
-    /// pretty canonical as you can see below.
-    /// --------------------------------------------------------------------------------------------
+    static void benchmarkMutexReads()
+    {
+        struct Geometry
+        {
+            qreal x      = 0;
+            qreal y      = 0;
+            qreal width  = 0;
+            qreal height = 0;
+        };
+
+        auto geometry = Geometry{};
+        auto mutex = std::mutex{};
+        auto inconsistentCount = 0;
+
+        auto stopped = std::atomic<bool>{false};
+        auto writer = std::thread{[&geometry, &mutex, &stopped] {
+            for (auto value = 1; !stopped.load(std::memory_order_relaxed); ++value) {
+                const auto lock = std::lock_guard{mutex};
+                geometry = {qreal(value), qreal(value), qreal(value), qreal(value)};
+            }
+        }};
+
+        const auto stopWriter = qScopeGuard([&stopped, &writer] {
+            stopped.store(true, std::memory_order_relaxed);
+            writer.join();
+        });
 
-private slots:
-    void testMetaObject()                   { runFeatureTest(); }
-    void testMetaObject_data()              { MAKE_TESTDATA(MetaObject); }
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i) {
+                const auto copy = [&geometry, &mutex] {
+                    const auto lock = std::lock_guard{mutex};
+                    return geometry;
+                }();
+
+                if (copy.y != copy.x || copy.width != copy.x || copy.height != copy.x)
+                    ++inconsistentCount;
+            }
+        }
 
-    void testPropertyDefinitions()          { runFeatureTest(); }
-    void testPropertyDefinitions_data()     { MAKE_TESTDATA(PropertyDefinitions); }
+        QCOMPARE(inconsistentCount, 0);
+    }
 
-    void testUniquePropertyIds()            { runFeatureTest(); }
-    void testUniquePropertyIds_data()       { MAKE_TESTDATA(UniquePropertyIds); }
+    enum class WriteMethod { Post, InvokeMethod, MetaProperty };
 
-    void testPropertyAddresses()            { runFeatureTest(); }
-    void testPropertyAddresses_data()       { MAKE_TESTDATA(PropertyAddresses); }
+    template<WriteMethod method>
+    static void benchmarkPostedWrites()
+    {
+        constexpr auto writerCount = 4;
+        constexpr auto writeCount = 10'000;
+
+        auto object = NObjectPostedWrites{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        object.progress.connect(&context, [&receivedCount] { ++receivedCount; });
+
+        const auto metaObject = object.metaObject();
+        const auto property = metaObject->property(metaObject->indexOfProperty("progress"));
+
+        const auto write = [&object, &property](int value) {
+            if constexpr (method == WriteMethod::Post) {
+                object.progress.post(value);
+            } else if constexpr (method == WriteMethod::InvokeMethod) {
+                QMetaObject::invokeMethod(&object, [&object, value] {
+                    object.progress = value;
+                }, Qt::QueuedConnection);
+            } else if constexpr (method == WriteMethod::MetaProperty) {
+                QMetaObject::invokeMethod(&object, [&object, &property, value] {
+                    property.write(&object, value);
+                }, Qt::QueuedConnection);
+            }
+        };
 
-    void testMethodDefinitions()            { runFeatureTest(); }
-    void testMethodDefinitions_data()       { MAKE_TESTDATA(MethodDefinitions); }
+        QBENCHMARK {
+            auto writers = std::vector<std::thread>{};
 
-    void testSignalAddresses()              { runFeatureTest(); }
-    void testSignalAddresses_data()         { MAKE_TESTDATA(SignalAddresses); }
+            for (auto i = 0; i < writerCount; ++i) {
+                writers.emplace_back([&write, i] {
+                    for (auto value = 1; value <= writeCount; ++value)
+                        write(i * writeCount + value);
+                });
+            }
 
-    void testNotifyPointers()               { runFeatureTest(); }
-    void testNotifyPointers_data()          { MAKE_TESTDATA(NotifyPointers); }
+            for (auto &writer: writers)
+                writer.join();
 
-    void testPropertyChanges()              { runBenchmark(); }
-    void testPropertyChanges_data()         { MAKE_TESTDATA(PropertyChanges); }
+            QCoreApplication::sendPostedEvents(&object);
 
-    void testPropertyNotifications()        { runBenchmark(); }
-    void testPropertyNotifications_data()   { MAKE_TESTDATA(PropertyNotifications); }
+            // Whichever writer finished last, its last value must have been applied.
+            QCOMPARE(object.progress() % writeCount, 0);
+        }
 
-    void testClassInfo()                    { runFeatureTest(); }
-    void testClassInfo_data()               { MAKE_TESTDATA(ClassInfo); }
+        QCOMPARE_GE(receivedCount, 1);
+    }
 
-    void testInterfaces()                   { runBenchmark(); }
-    void testInterfaces_data()              { MAKE_TESTDATA(Interfaces); }
+    template<class ObjectType>
+    static void benchmarkPropagation()
+    {
+        auto object = ObjectType{};
+        auto context = QObject{};
+        auto received = 0;
+        auto changes = 0;
 
-    void testEnumerators()                  { runFeatureTest(); }
-    void testEnumerators_data()             { MAKE_TESTDATA(Enumerators); }
+        const auto &sink = object.*ObjectType::sink;
+        sink.connect(&context, [&received] { ++received; });
+        QVERIFY(sink() > 0);
 
-    /// --------------------------------------------------------------------------------------------
-    /// An NObject specific test, testing its HelloWorld class and unique features
-    /// --------------------------------------------------------------------------------------------
+        QBENCHMARK {
+            object.input = ++changes;
+        }
 
-    void testNObject()
+        QCOMPARE(received, changes);
+        QCOMPARE(object.computations, (changes + 1) * ObjectType::nodeCount);
+    }
+
+    enum class ComputedOperation { Create, Write, WriteRead };
+
+    template<class ObjectType, ComputedOperation operation>
+    static void benchmarkComputedProperties()
     {
-        using npropertytest::HelloWorld;
+        constexpr auto operationCount = 10'000;
 
-        auto object     = HelloWorld{};
-        auto metaObject = object.staticMetaObject;
+        auto object = ObjectType{};
+        auto checksum = qint64{0};
 
-        SHOW(object.hello.label());
-        SHOW(object.world.label());
+        QBENCHMARK {
+            for (auto i = 1; i <= operationCount; ++i) {
+                if constexpr (operation == ComputedOperation::Create) {
+                    const auto created = ObjectType{};
+                    checksum += created.width();
+                } else {
+                    object.width = i;
+
+                    if constexpr (operation == ComputedOperation::WriteRead)
+                        checksum += object.area();
+                }
+            }
+        }
 
-        SHOW(object.hello.name());
-        SHOW(object.world.name());
+        QCOMPARE_GT(checksum + object.area(), 0);
+    }
 
-        SHOW(object.hello.value());
-        SHOW(object.world.value());
+    template<class ObjectType, bool scan>
+    static void benchmarkColumnarStorage()
+    {
+        constexpr auto objectCount = 100'000;
 
-        SHOW(object.hello());
-        SHOW(object.world());
+        auto objects = std::vector<std::unique_ptr<ObjectType>>{};
+        objects.reserve(objectCount);
 
-        SHOW(object.hello);
-        SHOW(object.world);
+        for (auto i = 0; i < objectCount; ++i)
+            objects.emplace_back(std::make_unique<ObjectType>());
 
-        const auto indices = QSet{object.hello.label(),
-                                  object.world.label()};
+        auto sum = qreal{0};
 
-        QCOMPARE(indices.count(), 2);
+        QBENCHMARK {
+            if constexpr (!scan) {
+                for (const auto &object: objects)
+                    object->weight = object->weight() + 1;
+            } else if constexpr (decltype(ObjectType::weight)::isColumnar()) {
+                for (const auto weight: decltype(ObjectType::weight)::column())
+                    sum += weight;
+            } else {
+                for (const auto &object: objects)
+                    sum += object->weight();
+            }
+        }
 
-        QCOMPARE(object.hello.name(), "hello");
-        QCOMPARE(object.world.name(), "world");
+        QVERIFY(sum >= 0);
+        QCOMPARE_GE(objects.front()->weight(), 1.0);
+    }
 
-        SHOW(object.hello.features().value);
-        SHOW(object.world.features().value);
+    template<class Index, bool lookup>
+    static void benchmarkPropertyIndex()
+    {
+        constexpr auto objectCount = 100'000;
+        constexpr auto operationCount = objectCount / 100;
 
-        static_assert( object.hello.isReadable());
-        static_assert(!object.hello.isResetable());
-        static_assert(!object.hello.isNotifiable());
-        static_assert(!object.hello.isWritable());
+        auto storage = std::vector<std::unique_ptr<NObjectRecord>>{};
+        auto objects = std::vector<NObjectRecord *>{};
 
-        static_assert( object.world.isReadable());
-        static_assert(!object.world.isResetable());
-        static_assert( object.world.isNotifiable());
-        static_assert( object.world.isWritable());
+        for (auto i = 0; i < objectCount; ++i) {
+            objects.emplace_back(storage.emplace_back(std::make_unique<NObjectRecord>()).get());
+            objects.back()->id = i;
+        }
 
-        SHOW(metaObject.property(1).read(&object));
-        SHOW(metaObject.property(2).read(&object));
+        using IndexPointer = std::conditional_t<std::is_void_v<Index>, std::nullptr_t, std::unique_ptr<Index>>;
+        auto index = IndexPointer{};
 
-        connect(&object, object.world.notifyPointer(), this, [](int newValue) {
-            qInfo("World has changed to %d...", newValue);
-        });
+        if constexpr (!std::is_void_v<Index>)
+            index = std::make_unique<Index>(objects);
 
-        object.world.connect(this, [](int newValue) {
-            qInfo("The world totally has changed to %d...", newValue);
-        });
+        const auto find = [&objects, &index](int id) -> NObjectRecord * {
+            if constexpr (std::is_void_v<Index>) {
+                const auto it = std::ranges::find(objects, id, [](NObjectRecord *object) {
+                    return object->id();
+                });
 
-        object.world = 13;
+                return it != objects.end() ? *it : nullptr;
+            } else {
+                return index->value(id);
+            }
+        };
 
-        using nproperty::detail::Prototype;
+        auto round = 0;
+        auto foundCount = 0;
 
-        // The objects returned by Prototype::get() are uninitialized, unconstructed data.
-        // The test will randomly crash when QCOMPARE() doesn't try to read metaObject(),
-        // and the like.
+        QBENCHMARK {
+            ++round;
 
-        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()),
-                 reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()));
+            for (auto i = 0; i < operationCount; ++i) {
+                const auto position = static_cast<std::size_t>((round * 7919 + i * 97) % objectCount);
 
-        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get<HelloWorld>()),
-                 reinterpret_cast<quintptr>(Prototype::get<NObjectMacro>()));
+                if constexpr (lookup) {
+                    if (find(objects[position]->id()) == objects[position])
+                        ++foundCount;
+                } else {
+                    objects[position]->id = objects[position]->id() + objectCount;
+                }
+            }
+        }
 
-        QCOMPARE(reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello)),
-                 reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello)));
+        if constexpr (lookup)
+            QCOMPARE_GT(foundCount, 0);
+        if constexpr (!lookup && !std::is_void_v<Index>)
+            QCOMPARE(index->size(), static_cast<std::size_t>(objectCount));
+    }
 
-        QVERIFY(reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::hello))
-             != reinterpret_cast<quintptr>(Prototype::get(&HelloWorld::world)));
+    template<auto property>
+    static void *makeChangeDetectionTest()
+    {
+        const auto testFunction = &PropertyExperiment::benchmarkChangeDetection<property>;
+        return reinterpret_cast<void *>(testFunction);
+    }
+
+    /// Alternately assigns two values to `property`. The strings are long, and only
+    /// differ at their very end, which is the worst case for comparing by equality.
+    /// The numbers only differ by jitter, which is ignored by fuzzy comparison.
+    ///
+    template<auto property>
+    static void benchmarkChangeDetection()
+    {
+        using PropertyType = nproperty::detail::DataMemberType<property>;
+        using ValueType    = typename PropertyType::ValueType;
+
+        const auto values = [] {
+            if constexpr (std::is_floating_point_v<ValueType>) {
+                return std::array<ValueType, 2>{1.0, 1.0 + 1e-14};
+            } else {
+                const auto prefix = QString{65536, u'x'};
+                return std::array<ValueType, 2>{prefix + u'a', prefix + u'b'};
+            }
+        }();
+
+        auto object = NObjectComparison{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        (object.*property).connect(&context, [&receivedCount] { ++receivedCount; });
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i)
+                (object.*property).setValue(values[static_cast<std::size_t>(i % 2)]);
+        }
+
+        if constexpr (PropertyType::hasFeature(nproperty::Feature::CompareFuzzy))
+            QCOMPARE(receivedCount, 0);
+        else
+            QCOMPARE_GE(receivedCount, 999);
+    }
+
+    template<class T>
+    void makeGeneratedMetaObjectRow()
+    {
+        QTest::newRow(T::staticMetaObject.className())
+                << T::MetaObject::generatedMetaObject()
+                << reinterpret_cast<TestFunctionPointer>(&T::MetaObject::buildMetaObject);
     }
 
-private:
 
     /// --------------------------------------------------------------------------------------------
     /// An initial test for the most basic properties of the generated QMetaObjects
@@ -643,6 +3487,93 @@ private:
         QCOMPARE(writableSpy,                   writableSpy4);
     }
 
+    /// --------------------------------------------------------------------------------------------
+    /// Measure the pure cost of emitting notifications, as that's the hottest path of properties.
+    /// --------------------------------------------------------------------------------------------
+
+    template <HasFeature<SignalEmissions> T>
+    static void testSignalEmissions(T &object)
+    {
+        constexpr auto emissionCount = 100;
+        auto receivedCount = 0;
+
+        QObject::connect(&object, &T::notifyingChanged, &object, [&receivedCount] {
+            ++receivedCount;
+        });
+
+        const auto notifyingChanged = &T::notifyingChanged;
+
+        for (auto i = 0; i < emissionCount; ++i)
+            (object.*notifyingChanged)(notifying2);
+
+        QCOMPARE(receivedCount, emissionCount);
+    }
+
+    /// --------------------------------------------------------------------------------------------
+    /// Measure the cost of changing a property, depending on how its notification signal is observed.
+    /// Usually properties are not observed, therefore that case deserves special attention.
+    /// --------------------------------------------------------------------------------------------
+
+    enum class Receiver { None, Direct, Queued };
+
+    template <HasFeature<SignalEmissions> T, Receiver receiver>
+    static void testChangeNotifications()
+    {
+        auto object = T{};
+        auto context = QObject{};
+        auto receivedCount = 0;
+
+        if constexpr (receiver != Receiver::None) {
+            const auto type = (receiver == Receiver::Direct ? Qt::DirectConnection
+                                                            : Qt::QueuedConnection);
+
+            QObject::connect(&object, &T::writableChanged, &context, [&receivedCount] {
+                ++receivedCount;
+            }, type);
+        }
+
+        const auto values = std::array{writable2, writable1}; // starts with a change
+
+        QBENCHMARK {
+            for (auto i = 0; i < 1000; ++i)
+                object.setWritable(values[static_cast<std::size_t>(i % 2)]);
+
+            // Queued notifications are delivered as part of the measurement,
+            // as otherwise they would pile up.
+            if constexpr (receiver == Receiver::Queued)
+                QCoreApplication::sendPostedEvents(&context);
+        }
+
+        if constexpr (receiver == Receiver::None)
+            QCOMPARE(receivedCount, 0);
+        else
+            QCOMPARE_GE(receivedCount, 1000);
+    }
+
+    template <class T>
+    static void makeChangeNotificationRows()
+    {
+        if constexpr (isImplementedFeature<SignalEmissions, T>) {
+            const auto makeRow = [](const char *receiver, auto testFunction) {
+                const auto className = T::staticMetaObject.className();
+                const auto tag = std::strrchr(className, ':') + 1;
+                Q_ASSERT((tag - 1) != nullptr && tag[-1] == ':');
+
+                QTest::addRow("%s/%s", tag, receiver) << testFunction;
+            };
+
+            if constexpr (!isSkippedFeature<SignalEmissions, T>) {
+                makeRow("no receiver",     makeTestFunction<&testChangeNotifications<T, Receiver::None>>());
+                makeRow("direct receiver", makeTestFunction<&testChangeNotifications<T, Receiver::Direct>>());
+                makeRow("queued receiver", makeTestFunction<&testChangeNotifications<T, Receiver::Queued>>());
+            } else {
+                makeRow("no receiver",     TestFunctionPointer{});
+                makeRow("direct receiver", TestFunctionPointer{});
+                makeRow("queued receiver", TestFunctionPointer{});
+            }
+        }
+    }
+
     /// --------------------------------------------------------------------------------------------
     /// Verify that classinfo is generated
     /// --------------------------------------------------------------------------------------------
@@ -856,6 +3787,12 @@ private:
         auto object = T{};
         Delegate{}(object);
     }
+
+    template<TestFunction testFunction>
+    static TestFunctionPointer makeTestFunction()
+    {
+        return reinterpret_cast<TestFunctionPointer>(testFunction);
+    }
 };
 
 } // namespace
@@ -0,0 +1,238 @@
+#include "nbulkquery.h"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+#if defined(__x86_64__) && (defined(Q_CC_GNU) || defined(Q_CC_CLANG))
+#define NPROPERTY_HAS_AVX2_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace nproperty::detail::simd {
+
+namespace {
+
+// The portable kernels are written as plain loops, so that compilers can
+// vectorize them for the baseline instruction set, e.g. SSE2 on x86-64.
+
+qint64 sumPortable(std::span<const qint32> values) noexcept
+{
+    return std::accumulate(values.begin(), values.end(), qint64{0});
+}
+
+double sumPortable(std::span<const double> values) noexcept
+{
+    return std::accumulate(values.begin(), values.end(), 0.0);
+}
+
+template<typename T>
+T minimumPortable(std::span<const T> values) noexcept
+{
+    auto result = std::numeric_limits<T>::max();
+
+    for (const auto value: values)
+        result = std::min(result, value);
+
+    return result;
+}
+
+template<typename T>
+T maximumPortable(std::span<const T> values) noexcept
+{
+    auto result = std::numeric_limits<T>::lowest();
+
+    for (const auto value: values)
+        result = std::max(result, value);
+
+    return result;
+}
+
+template<typename T>
+void greaterThanPortable(std::span<const T> values, T threshold,
+                         IndexList &indices, std::size_t first = 0)
+{
+    for (auto i = first; i < values.size(); ++i) {
+        if (values[i] > threshold)
+            indices.emplace_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+#ifdef NPROPERTY_HAS_AVX2_KERNELS
+
+#define NPROPERTY_AVX2 __attribute__((target("avx2")))
+
+/// Appends the index of each set bit in `mask`, offset by `first`.
+///
+void appendIndices(unsigned mask, std::size_t first, IndexList &indices)
+{
+    for (; mask != 0; mask &= mask - 1) {
+        const auto bit = static_cast<std::size_t>(std::countr_zero(mask));
+        indices.emplace_back(static_cast<std::uint32_t>(first + bit));
+    }
+}
+
+NPROPERTY_AVX2 qint64 sumAvx2(std::span<const qint32> values) noexcept
+{
+    auto accumulator = _mm256_setzero_si256();
+    auto i = std::size_t{0};
+
+    for (; i + 8 <= values.size(); i += 8) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&values[i]));
+        const auto lower = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(chunk));
+        const auto upper = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(chunk, 1));
+        accumulator = _mm256_add_epi64(accumulator, _mm256_add_epi64(lower, upper));
+    }
+
+    alignas(32) qint64 lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumPortable(values.subspan(i));
+}
+
+NPROPERTY_AVX2 double sumAvx2(std::span<const double> values) noexcept
+{
+    auto accumulator = _mm256_setzero_pd();
+    auto i = std::size_t{0};
+
+    for (; i + 4 <= values.size(); i += 4)
+        accumulator = _mm256_add_pd(accumulator, _mm256_loadu_pd(&values[i]));
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, accumulator);
+
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sumPortable(values.subspan(i));
+}
+
+NPROPERTY_AVX2 qint32 minimumAvx2(std::span<const qint32> values) noexcept
+{
+    auto accumulator = _mm256_set1_epi32(std::numeric_limits<qint32>::max());
+    auto i = std::size_t{0};
+
+    for (; i + 8 <= values.size(); i += 8) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&values[i]));
+        accumulator = _mm256_min_epi32(accumulator, chunk);
+    }
+
+    alignas(32) qint32 lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+
+    return std::min(std::ranges::min(lanes), minimumPortable(values.subspan(i)));
+}
+
+NPROPERTY_AVX2 double minimumAvx2(std::span<const double> values) noexcept
+{
+    auto accumulator = _mm256_set1_pd(std::numeric_limits<double>::max());
+    auto i = std::size_t{0};
+
+    for (; i + 4 <= values.size(); i += 4)
+        accumulator = _mm256_min_pd(accumulator, _mm256_loadu_pd(&values[i]));
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, accumulator);
+
+    return std::min(std::ranges::min(lanes), minimumPortable(values.subspan(i)));
+}
+
+NPROPERTY_AVX2 qint32 maximumAvx2(std::span<const qint32> values) noexcept
+{
+    auto accumulator = _mm256_set1_epi32(std::numeric_limits<qint32>::lowest());
+    auto i = std::size_t{0};
+
+    for (; i + 8 <= values.size(); i += 8) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&values[i]));
+        accumulator = _mm256_max_epi32(accumulator, chunk);
+    }
+
+    alignas(32) qint32 lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+
+    return std::max(std::ranges::max(lanes), maximumPortable(values.subspan(i)));
+}
+
+NPROPERTY_AVX2 double maximumAvx2(std::span<const double> values) noexcept
+{
+    auto accumulator = _mm256_set1_pd(std::numeric_limits<double>::lowest());
+    auto i = std::size_t{0};
+
+    for (; i + 4 <= values.size(); i += 4)
+        accumulator = _mm256_max_pd(accumulator, _mm256_loadu_pd(&values[i]));
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, accumulator);
+
+    return std::max(std::ranges::max(lanes), maximumPortable(values.subspan(i)));
+}
+
+NPROPERTY_AVX2 void greaterThanAvx2(std::span<const qint32> values, qint32 threshold, IndexList &indices)
+{
+    const auto thresholds = _mm256_set1_epi32(threshold);
+    auto i = std::size_t{0};
+
+    for (; i + 8 <= values.size(); i += 8) {
+        const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&values[i]));
+        const auto matches = _mm256_cmpgt_epi32(chunk, thresholds);
+        appendIndices(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(matches))), i, indices);
+    }
+
+    greaterThanPortable(values, threshold, indices, i);
+}
+
+NPROPERTY_AVX2 void greaterThanAvx2(std::span<const double> values, double threshold, IndexList &indices)
+{
+    const auto thresholds = _mm256_set1_pd(threshold);
+    auto i = std::size_t{0};
+
+    for (; i + 4 <= values.size(); i += 4) {
+        const auto matches = _mm256_cmp_pd(_mm256_loadu_pd(&values[i]), thresholds, _CMP_GT_OQ);
+        appendIndices(static_cast<unsigned>(_mm256_movemask_pd(matches)), i, indices);
+    }
+
+    greaterThanPortable(values, threshold, indices, i);
+}
+
+#undef NPROPERTY_AVX2
+
+#endif // NPROPERTY_HAS_AVX2_KERNELS
+
+} // namespace
+
+bool hasAvx2() noexcept
+{
+#ifdef NPROPERTY_HAS_AVX2_KERNELS
+    static const auto s_hasAvx2 = __builtin_cpu_supports("avx2") != 0;
+    return s_hasAvx2;
+#else
+    return false;
+#endif
+}
+
+#ifdef NPROPERTY_HAS_AVX2_KERNELS
+#define NPROPERTY_DISPATCH(Function, ...) \
+    (hasAvx2() ? Function##Avx2(__VA_ARGS__) : Function##Portable(__VA_ARGS__))
+#else
+#define NPROPERTY_DISPATCH(Function, ...) \
+    Function##Portable(__VA_ARGS__)
+#endif
+
+qint64 sum(std::span<const qint32> values) noexcept { return NPROPERTY_DISPATCH(sum, values); }
+double sum(std::span<const double> values) noexcept { return NPROPERTY_DISPATCH(sum, values); }
+
+qint32 minimum(std::span<const qint32> values) noexcept { return NPROPERTY_DISPATCH(minimum, values); }
+double minimum(std::span<const double> values) noexcept { return NPROPERTY_DISPATCH(minimum, values); }
+qint32 maximum(std::span<const qint32> values) noexcept { return NPROPERTY_DISPATCH(maximum, values); }
+double maximum(std::span<const double> values) noexcept { return NPROPERTY_DISPATCH(maximum, values); }
+
+void greaterThan(std::span<const qint32> values, qint32 threshold, IndexList &indices)
+{
+    NPROPERTY_DISPATCH(greaterThan, values, threshold, indices);
+}
+
+void greaterThan(std::span<const double> values, double threshold, IndexList &indices)
+{
+    NPROPERTY_DISPATCH(greaterThan, values, threshold, indices);
+}
+
+#undef NPROPERTY_DISPATCH
+
+} // namespace nproperty::detail::simd
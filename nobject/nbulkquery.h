@@ -0,0 +1,148 @@
+#ifndef NPROPERTY_NBULKQUERY_H
+#define NPROPERTY_NBULKQUERY_H
+
+#include "nmetaobject.h"
+
+#include <limits>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace nproperty {
+
+namespace detail {
+
+/// An allocator for scratch buffers that are aligned for the widest vector registers in use.
+///
+template<typename T, std::size_t Alignment = 32>
+struct AlignedAllocator
+{
+    using value_type = T;
+
+    template<typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+    [[nodiscard]] T *allocate(std::size_t count)
+    {
+        return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T *pointer, std::size_t) noexcept
+    {
+        ::operator delete(pointer, std::align_val_t{Alignment});
+    }
+
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+};
+
+/// Numeric kernels over gathered property values. They use AVX2 if the CPU supports it,
+/// and portable loops otherwise. Sums of integers are computed with 64 bits. The minimum
+/// and maximum of an empty range are the largest and the lowest value of the type.
+///
+namespace simd {
+
+using IndexList = std::vector<std::uint32_t>;
+
+[[nodiscard]] qint64 sum    (std::span<const qint32> values) noexcept;
+[[nodiscard]] double sum    (std::span<const double> values) noexcept;
+[[nodiscard]] qint32 minimum(std::span<const qint32> values) noexcept;
+[[nodiscard]] double minimum(std::span<const double> values) noexcept;
+[[nodiscard]] qint32 maximum(std::span<const qint32> values) noexcept;
+[[nodiscard]] double maximum(std::span<const double> values) noexcept;
+
+/// Appends the index of each value that is greater than `threshold` to `indices`.
+///
+void greaterThan(std::span<const qint32> values, qint32 threshold, IndexList &indices);
+void greaterThan(std::span<const double> values, double threshold, IndexList &indices);
+
+/// Reports if the AVX2 kernels are used.
+///
+[[nodiscard]] bool hasAvx2() noexcept;
+
+} // namespace simd
+
+template<typename T>
+concept BulkQueryValueType = std::is_same_v<T, qint32> || std::is_same_v<T, double>;
+
+} // namespace detail
+
+/// Filters and reductions of a numeric `Property` over many objects: The property's
+/// values are gathered into an aligned buffer once, and then kept up-to-date by the
+/// property's notification signal. Therefore repeated queries neither touch the
+/// objects, nor the metaobject system. The objects must outlive the query.
+///
+/// ``` C++
+/// auto query = BulkQuery<&Particle::mass>{particles};
+/// const auto heavy = query.greaterThan(10.0);
+/// ```
+///
+template<auto Property>
+class BulkQuery
+{
+public:
+    using PropertyType = detail::DataMemberType<Property>;
+    using   ObjectType = typename PropertyType::ObjectType;
+    using    ValueType = typename PropertyType::ValueType;
+    using      SumType = std::conditional_t<std::is_integral_v<ValueType>, qint64, ValueType>;
+
+    static_assert(detail::BulkQueryValueType<ValueType>,
+                  "Bulk queries are implemented for int and double properties");
+    static_assert(PropertyType::isNotifiable(),
+                  "Bulk queries rely on the property's notification signal");
+
+    explicit BulkQuery(std::span<ObjectType *const> objects)
+        : m_objects{objects.begin(), objects.end()}
+    {
+        m_values.reserve(m_objects.size());
+
+        for (const auto object: m_objects) {
+            const auto index = m_values.size();
+            m_values.emplace_back((object->*Property).value());
+
+            (object->*Property).connect(&m_context, [this, index](ValueType value) {
+                m_values[index] = value;
+            });
+        }
+    }
+
+    BulkQuery(const BulkQuery &) = delete;
+    BulkQuery &operator=(const BulkQuery &) = delete;
+
+    [[nodiscard]] std::span<ObjectType *const> objects() const noexcept { return m_objects; }
+    [[nodiscard]] std::span<const ValueType>    values() const noexcept { return m_values; }
+
+    [[nodiscard]] SumType   sum()     const noexcept { return detail::simd::sum    (values()); }
+    [[nodiscard]] ValueType minimum() const noexcept { return detail::simd::minimum(values()); }
+    [[nodiscard]] ValueType maximum() const noexcept { return detail::simd::maximum(values()); }
+
+    /// Returns the objects whose property value is greater than `threshold`, in their original order.
+    ///
+    [[nodiscard]] std::vector<ObjectType *> greaterThan(ValueType threshold) const
+    {
+        auto indices = detail::simd::IndexList{};
+        detail::simd::greaterThan(values(), threshold, indices);
+
+        auto result = std::vector<ObjectType *>{};
+        result.reserve(indices.size());
+
+        for (const auto index: indices)
+            result.emplace_back(m_objects[index]);
+
+        return result;
+    }
+
+private:
+    std::vector<ObjectType *>                                   m_objects;
+    std::vector<ValueType, detail::AlignedAllocator<ValueType>> m_values;
+    QObject                                                     m_context;
+};
+
+} // namespace nproperty
+
+#endif // NPROPERTY_NBULKQUERY_H
@@ -0,0 +1,212 @@
+#ifndef NPROPERTY_NINDEX_H
+#define NPROPERTY_NINDEX_H
+
+#include "nmetaobject.h"
+
+#include <map>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace nproperty {
+
+namespace detail {
+
+/// Hashes keys by `qHash()`, so that all Qt types can be used as keys.
+///
+template<typename Key>
+struct QtHasher
+{
+    std::size_t operator()(const Key &key) const noexcept(noexcept(qHash(key)))
+    {
+        return static_cast<std::size_t>(qHash(key));
+    }
+};
+
+template<typename Key, typename Value>
+using HashMap = std::unordered_map<Key, Value, QtHasher<Key>>;
+
+template<typename Key, typename Value>
+using OrderedMap = std::map<Key, Value>;
+
+/// Where an object is stored within an index. The address of a map's element
+/// is stable, also if other elements are added, or the hash table is rehashed.
+///
+template<typename Entry>
+struct IndexPosition
+{
+    Entry       *entry;
+    std::size_t  index;
+};
+
+} // namespace detail
+
+/// Finds objects by the value of their `Property`. The index is kept up-to-date by
+/// the property's notification signal: Each change moves the object from the bucket
+/// of its old value into the bucket of its new value, which costs one lookup in the
+/// `Map`. Destroyed objects are removed automatically. Use `HashIndex` or `OrderedIndex`.
+///
+template<auto Property, template<typename, typename> class Map>
+class PropertyIndex
+{
+public:
+    using PropertyType = detail::DataMemberType<Property>;
+    using   ObjectType = typename PropertyType::ObjectType;
+    using    ValueType = typename PropertyType::ValueType;
+
+private:
+    using Bucket    = std::vector<ObjectType *>;
+    using Container = Map<ValueType, Bucket>;
+    using Position  = detail::IndexPosition<typename Container::value_type>;
+
+public:
+    static constexpr bool isOrdered() noexcept
+    {
+        return std::is_same_v<Container, detail::OrderedMap<ValueType, Bucket>>;
+    }
+
+    static_assert(PropertyType::isNotifiable(),
+                  "Indexes rely on the property's notification signal");
+
+    PropertyIndex() = default;
+
+    explicit PropertyIndex(std::span<ObjectType *const> objects)
+    {
+        m_positions.reserve(objects.size());
+
+        for (const auto object: objects)
+            insert(object);
+    }
+
+    PropertyIndex(const PropertyIndex &) = delete;
+    PropertyIndex &operator=(const PropertyIndex &) = delete;
+
+    /// Adds `object` to this index, unless it already is part of it.
+    ///
+    void insert(ObjectType *object)
+    {
+        if (m_positions.contains(object))
+            return;
+
+        m_positions.emplace(object, append(object, (object->*Property).value()));
+
+        (object->*Property).connect(&m_context, [this, object](const ValueType &value) {
+            update(object, value);
+        });
+
+        QObject::connect(object, &QObject::destroyed, &m_context, [this, object] {
+            remove(object);
+        });
+    }
+
+    /// Removes `object` from this index.
+    ///
+    void remove(ObjectType *object)
+    {
+        const auto it = m_positions.find(object);
+
+        if (it == m_positions.end())
+            return;
+
+        release(it->second);
+        m_positions.erase(it);
+
+        // Only the pointer is used, as `object` might be destroyed already.
+        QObject::disconnect(object, nullptr, &m_context, nullptr);
+    }
+
+    /// Returns all objects whose property has `value`, in no particular order.
+    ///
+    [[nodiscard]] std::span<ObjectType *const> find(const ValueType &value) const
+    {
+        if (const auto it = m_buckets.find(value); it != m_buckets.end())
+            return it->second;
+
+        return {};
+    }
+
+    /// Returns some object whose property has `value`, or `nullptr`.
+    ///
+    [[nodiscard]] ObjectType *value(const ValueType &value) const
+    {
+        const auto objects = find(value);
+        return objects.empty() ? nullptr : objects.front();
+    }
+
+    [[nodiscard]] bool contains(const ValueType &value) const { return m_buckets.contains(value); }
+
+    /// The number of objects in this index, and the number of their distinct values.
+    ///
+    [[nodiscard]] std::size_t size() const noexcept { return m_positions.size(); }
+    [[nodiscard]] std::size_t keyCount() const noexcept { return m_buckets.size(); }
+
+    /// Calls `function` for each object whose property is within `[first, last)`, in
+    /// ascending order of the values. This is only available for ordered indexes.
+    ///
+    template<std::invocable<ObjectType *> Function>
+    requires(isOrdered())
+    void forEachInRange(const ValueType &first, const ValueType &last, Function &&function) const
+    {
+        const auto end = m_buckets.lower_bound(last);
+
+        for (auto it = m_buckets.lower_bound(first); it != end; ++it) {
+            for (const auto object: it->second)
+                std::invoke(function, object);
+        }
+    }
+
+private:
+    Position append(ObjectType *object, const ValueType &value)
+    {
+        auto &entry = *m_buckets.try_emplace(value).first;
+        entry.second.emplace_back(object);
+        return {&entry, entry.second.size() - 1};
+    }
+
+    void release(const Position &position)
+    {
+        auto &bucket = position.entry->second;
+
+        // Fill the gap with the bucket's last object, and update its position.
+        if (position.index + 1 < bucket.size()) {
+            bucket[position.index] = bucket.back();
+            m_positions[bucket[position.index]].index = position.index;
+        }
+
+        bucket.pop_back();
+
+        // The key is owned by the entry, therefore the entry is looked up first.
+        if (bucket.empty())
+            m_buckets.erase(m_buckets.find(position.entry->first));
+    }
+
+    void update(ObjectType *object, const ValueType &value)
+    {
+        auto &position = m_positions[object];
+
+        if (position.entry->first == value)
+            return;
+
+        release(position);
+        position = append(object, value);
+    }
+
+    Container                                   m_buckets;
+    std::unordered_map<ObjectType *, Position>  m_positions;
+    QObject                                     m_context;
+};
+
+/// An index for finding objects by the value of `Property` in constant time.
+///
+template<auto Property>
+using HashIndex = PropertyIndex<Property, detail::HashMap>;
+
+/// An index for finding objects by the value of `Property` in logarithmic
+/// time, which also can enumerate objects by ranges of values.
+///
+template<auto Property>
+using OrderedIndex = PropertyIndex<Property, detail::OrderedMap>;
+
+} // namespace nproperty
+
+#endif // NPROPERTY_NINDEX_H
@@ -1,10 +1,21 @@
 #include "nmetaobject.h"
 
 #include <private/qmetaobjectbuilder_p.h>
+#include <private/qobject_p.h>
 
+#include <QBasicTimer>
+#include <QCoreApplication>
 #include <QObject>
 #include <QLoggingCategory>
-
+#include <QPointer>
+#include <QThread>
+#include <QTimerEvent>
+
+#include <bit>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <new>
 #include <ranges>
 
 namespace nproperty::detail {
@@ -34,7 +45,12 @@ std::ranges::borrowed_iterator_t<Range> find(Range &&range, const T &value,
                                              Projection projection = {})
 {
     if constexpr (std::totally_ordered<T> && !std::is_pointer_v<T>) {
-        return std::ranges::lower_bound(range, value, {}, projection);
+        const auto it = std::ranges::lower_bound(range, value, {}, projection);
+
+        if (it != std::ranges::end(range) && std::invoke(projection, *it) != value)
+            return std::ranges::end(range);
+
+        return it;
     } else {
         return std::ranges::find(range, value, projection);
     }
@@ -55,17 +71,14 @@ LabelId memberToLabel(const MemberInfo &member)
     return member.label;
 }
 
-LabelId memberPointerToLabel(const MemberInfo *member)
-{
-    Q_ASSERT(member != nullptr);
-    return member->label;
-}
-
-const void *memberToPointer(const MemberInfo *member)
+/// Function addresses are aligned, therefore their lowest bits carry little
+/// information. Fibonacci hashing moves the entropy into the upper bits, which
+/// are used to index the signal table.
+///
+std::size_t hashPointer(const void *pointer) noexcept
 {
-    Q_ASSERT(member != nullptr);
-    Q_ASSERT(member->pointer);
-    return member->pointer();
+    const auto value = static_cast<quint64>(reinterpret_cast<quintptr>(pointer));
+    return static_cast<std::size_t>((value * 0x9e3779b97f4a7c15ULL) >> 32);
 }
 
 QByteArray toByteArray(const std::string_view &sv)
@@ -80,12 +93,11 @@ void MetaObjectData::emplace(MemberInfo &&member)
     if (Q_UNLIKELY(!member))
         return;
 
-    if (member.type == MemberInfo::Type::Interface)
-        m_interfaceOffsets.emplace_back(m_members.size());
-
     if (member.type == MemberInfo::Type::Property) {
         if (canonical(member.features).contains(Feature::Notify))
             m_signalOffsets.emplace_back(m_members.size());
+        if (canonical(member.features).contains(Feature::Computed))
+            m_computedProperties.emplace_back(m_propertyOffsets.size());
 
         m_propertyOffsets.emplace_back(m_members.size());
     }
@@ -128,19 +140,6 @@ void MetaObjectData::metaCall(QObject           *object,
               static_cast<const void *>(args));
 }
 
-void *MetaObjectData::interfaceCast(QObject *object, std::string_view name) const
-{
-    for (const auto iface : m_interfaceOffsets
-                                | std::views::transform(makeOffsetToInterface())) {
-        if (name == iface->name)
-            return iface->metacast(object);
-        if (name == iface->value) // FIXME: there should be an alias that says `iid`
-            return iface->metacast(object);
-    }
-
-    return nullptr;
-}
-
 void MetaObjectData::validateMembers() const
 {
     if (lcMetaObject().isDebugEnabled()) {
@@ -166,6 +165,40 @@ void MetaObjectData::validateMembers() const
     }
 }
 
+void MetaObjectData::buildLookupTables()
+{
+    m_signalLabels.clear();
+    m_signalLabels.reserve(m_signalOffsets.size());
+    m_signalTable.clear();
+
+    if (!m_signalOffsets.empty())
+        m_signalTable.resize(std::bit_ceil(2 * m_signalOffsets.size()));
+
+    const auto mask = m_signalTable.size() - 1;
+
+    for (const auto offset: m_signalOffsets) {
+        const auto signalInfo = memberInfo(offset);
+
+        Q_ASSERT(signalInfo != nullptr);
+        Q_ASSERT(signalInfo->type == MemberInfo::Type::Signal
+                 || signalInfo->type == MemberInfo::Type::Property);
+        Q_ASSERT(signalInfo->pointer != nullptr);
+
+        const auto pointer = signalInfo->pointer();
+        auto i = hashPointer(pointer) & mask;
+
+        while (m_signalTable[i].pointer != nullptr) {
+            Q_ASSERT(m_signalTable[i].pointer != pointer);
+            i = (i + 1) & mask;
+        }
+
+        m_signalTable[i] = {pointer, static_cast<int>(m_signalLabels.size())};
+        m_signalLabels.emplace_back(signalInfo->label);
+    }
+
+    m_computedRanking.reset(m_computedProperties.size());
+}
+
 const MemberInfo *MetaObjectData::propertyInfo(MemberOffset offset) const noexcept
 {
     if (Q_UNLIKELY(offset >= m_propertyOffsets.size()))
@@ -191,6 +224,9 @@ quintptr MetaObjectData::memberOffset(LabelId label) const noexcept
 {
     if (const auto it = ranges::find(m_members, label, memberToLabel);
         Q_LIKELY(it != m_members.cend())) {
+        if (it->offset.has_value())
+            return *it->offset;
+
         Q_ASSERT(it->resolveOffset);
         return it->resolveOffset();
     }
@@ -199,49 +235,149 @@ quintptr MetaObjectData::memberOffset(LabelId label) const noexcept
     return 0;
 }
 
-std::function<const MemberInfo *(quintptr)> MetaObjectData::makeOffsetToInterface() const noexcept
+int MetaObjectData::metaMethodForPointer(const void *pointer) const noexcept
 {
-    return [this](quintptr offset) {
-        const auto interfaceInfo = memberInfo(offset);
+    if (Q_UNLIKELY(m_signalTable.empty() || pointer == nullptr))
+        return -1;
 
-        Q_ASSERT(interfaceInfo           != nullptr);
-        Q_ASSERT(interfaceInfo->type     == MemberInfo::Type::Interface);
-        Q_ASSERT(interfaceInfo->name     != std::string_view{});
-        Q_ASSERT(interfaceInfo->value    != std::string_view{});
-        Q_ASSERT(interfaceInfo->metacast != nullptr);
+    const auto mask = m_signalTable.size() - 1;
 
-        return interfaceInfo;
-    };
+    // The table is at most half full, so probing always reaches an empty slot.
+    for (auto i = hashPointer(pointer) & mask;; i = (i + 1) & mask) {
+        if (m_signalTable[i].pointer == pointer)
+            return m_signalTable[i].index;
+        if (m_signalTable[i].pointer == nullptr)
+            return -1;
+    }
 }
 
-std::function<const MemberInfo *(quintptr)> MetaObjectData::makeOffsetToSignal() const noexcept
+int MetaObjectData::metaMethodIndexForLabel(LabelId label) const noexcept
 {
-    return [this](quintptr offset) {
-        const auto signalInfo = memberInfo(offset);
+    return ranges::indexOf(m_signalLabels, label);
+}
 
-        Q_ASSERT(signalInfo != nullptr);
-        Q_ASSERT(signalInfo->type == MemberInfo::Type::Signal
-                 || signalInfo->type == MemberInfo::Type::Property);
-        Q_ASSERT(signalInfo->pointer != nullptr);
+void MetaObjectData::emitNotifications(QObject *object, const std::vector<bool> &changed) const
+{
+    Q_ASSERT(changed.size() <= m_signalOffsets.size());
 
-        return signalInfo;
-    };
+    // Receivers might destroy the object. Then the remaining notifications are dropped.
+    const auto guard = QPointer<QObject>{object};
+
+    for (auto i = 0u; i < changed.size() && !guard.isNull(); ++i) {
+        if (!changed[i])
+            continue;
+
+        const auto member = memberInfo(m_signalOffsets[i]);
+
+        Q_ASSERT(member != nullptr);
+        Q_ASSERT(member->notifyProperty != nullptr);
+
+        member->notifyProperty(object);
+    }
 }
 
-int MetaObjectData::metaMethodForPointer(const void *pointer) const noexcept
+void MetaObjectData::copyProperties(const QObject *object, const SnapshotLayout &layout,
+                                    std::byte *storage) const
+{
+    Q_ASSERT(layout.offsets.size() == m_propertyOffsets.size());
+
+    for (auto i = std::size_t{0}; i < m_propertyOffsets.size(); ++i) {
+        const auto member = memberInfo(m_propertyOffsets[i]);
+        Q_ASSERT(member != nullptr);
+
+        // Like QMetaProperty::read() this constructs the value first, as readProperty() assigns.
+        const auto value = storage + layout.offsets[i];
+        QMetaType{member->metaType}.construct(value);
+        member->readProperty(object, value);
+    }
+}
+
+void MetaObjectData::destroyProperties(const SnapshotLayout &layout, std::byte *storage) const noexcept
 {
-    return ranges::indexOf(m_signalOffsets
-                               | std::views::transform(makeOffsetToSignal())
-                               | std::views::transform(memberToPointer),
-                           pointer);
+    for (auto i = std::size_t{0}; i < m_propertyOffsets.size(); ++i) {
+        const auto member = memberInfo(m_propertyOffsets[i]);
+        QMetaType{member->metaType}.destruct(storage + layout.offsets[i]);
+    }
 }
 
-int MetaObjectData::metaMethodIndexForLabel(LabelId label) const noexcept
+void MetaObjectData::invalidateDependents(QObject *object, DependencyGraph &graph,
+                                          std::size_t propertyIndex) const
+{
+    graph.markDependents(propertyIndex, DependencyGraph::Uncomputed::Included);
+
+    if (!graph.isDeferred())
+        updateDependents(object, graph);
+}
+
+void MetaObjectData::updateDependents(QObject *object, DependencyGraph &graph) const
 {
-    return ranges::indexOf(m_signalOffsets
-                               | std::views::transform(makeOffsetToSignal())
-                               | std::views::transform(memberPointerToLabel),
-                           label);
+    auto &dirty = graph.dirty();
+    auto order  = m_computedRanking.current();
+
+    const auto recomputation = graph.isDeferred() ? Recomputation::Eager : Recomputation::Lazy;
+
+    // Dependents marked dirty by this loop always are ranked behind the current property.
+    for (auto i = DependencyGraph::findNext(order, dirty, 0); i != PropertyBits::npos;) {
+        dirty.reset(i);
+
+        const auto member = propertyInfo(m_computedProperties[i]);
+
+        Q_ASSERT(member != nullptr);
+        Q_ASSERT(member->expireProperty != nullptr);
+
+        switch (member->expireProperty(object, recomputation)) {
+        case Expiry::Unchanged:
+            break;
+
+        case Expiry::Changed:
+            graph.changed().set(i);
+            [[fallthrough]];
+
+        case Expiry::Invalidated:
+            graph.markDependents(m_computedProperties[i], DependencyGraph::Uncomputed::Excluded);
+            break;
+        }
+
+        // If this property has read a computed property ranked behind it, that one might
+        // have been dirty, and this property got computed from its stale value. Once the
+        // order is fixed, this property is ranked behind it, and gets marked dirty again
+        // if that one changes. Therefore the visit starts over with the new order. This
+        // also happens if another object of this class has changed the order meanwhile.
+        if (const auto current = m_computedRanking.current(); current != order) {
+            order = current;
+            i = DependencyGraph::findNext(order, dirty, 0);
+        } else {
+            i = DependencyGraph::findNext(order, dirty, ComputedRanking::rank(order, i) + 1);
+        }
+    }
+}
+
+void MetaObjectData::notifyDependents(QObject *object, DependencyGraph &graph) const
+{
+    auto &changed = graph.changed();
+
+    // Receivers might change properties again, and then notify computed
+    // properties themselves. Therefore each bit is cleared before notifying.
+    // They also might destroy the object, and with it the graph. Then the
+    // remaining notifications are dropped.
+    const auto guard = QPointer<QObject>{object};
+    const auto order = m_computedRanking.current();
+
+    for (auto i = DependencyGraph::findNext(order, changed, 0); i != PropertyBits::npos;) {
+        changed.reset(i);
+
+        const auto member = propertyInfo(m_computedProperties[i]);
+
+        Q_ASSERT(member != nullptr);
+        Q_ASSERT(member->notifyChange != nullptr);
+
+        member->notifyChange(object);
+
+        if (guard.isNull())
+            break;
+
+        i = DependencyGraph::findNext(order, changed, ComputedRanking::rank(order, i) + 1);
+    }
 }
 
 void MetaObjectData::readProperty(const QObject *object, MemberOffset offset, void *result) const
@@ -282,6 +418,376 @@ void MetaObjectData::indexOfMethod(int *result, void *pointer) const noexcept
     *result = metaMethodForPointer(pointer);
 }
 
+void ComputedRanking::reset(std::size_t computedCount)
+{
+    m_count   = computedCount;
+    m_rowSize = (computedCount + WordBits - 1) / WordBits;
+    m_edges   = std::make_unique<std::atomic<Word>[]>(m_count * m_rowSize);
+
+    m_current.store(nullptr, std::memory_order_relaxed);
+    m_orders.clear();
+}
+
+void ComputedRanking::record(std::size_t dependent, std::size_t dependency)
+{
+    if (dependent == dependency)
+        return;
+
+    auto &word = edge(dependent, dependency);
+
+    if (word.load(std::memory_order_relaxed) & bit(dependency))
+        return;
+
+    const auto lock = std::lock_guard{m_mutex};
+
+    if (word.fetch_or(bit(dependency), std::memory_order_relaxed) & bit(dependency))
+        return;
+
+    const auto order = m_current.load(std::memory_order_relaxed);
+
+    if (rank(order, dependency) > rank(order, dependent))
+        updateOrder();
+}
+
+void ComputedRanking::updateOrder()
+{
+    // Kahn's algorithm: Counts for each computed property the computed properties it has
+    // read, and ranks it once all of them are ranked. Self-references are never recorded.
+    auto pending = std::vector<std::size_t>(m_count, 0);
+    auto order   = std::make_unique<Order>();
+    auto &ranked = order->computedIndices;
+
+    ranked.reserve(m_count);
+
+    for (auto i = std::size_t{0}; i < m_count; ++i) {
+        for (auto j = std::size_t{0}; j < m_count; ++j) {
+            if (hasEdge(i, j))
+                ++pending[i];
+        }
+
+        if (pending[i] == 0)
+            ranked.push_back(i);
+    }
+
+    for (auto next = std::size_t{0}; next < ranked.size(); ++next) {
+        const auto dependency = ranked[next];
+
+        for (auto dependent = std::size_t{0}; dependent < m_count; ++dependent) {
+            if (hasEdge(dependent, dependency) && --pending[dependent] == 0)
+                ranked.push_back(dependent);
+        }
+    }
+
+    // Properties of cycles never get ready. They are ranked last, in declaration order.
+    for (auto i = std::size_t{0}; i < m_count && ranked.size() < m_count; ++i) {
+        if (pending[i] > 0)
+            ranked.push_back(i);
+    }
+
+    if (const auto current = m_current.load(std::memory_order_relaxed);
+        current ? ranked == current->computedIndices : std::ranges::is_sorted(ranked))
+        return;
+
+    order->ranks.resize(m_count);
+
+    for (auto rank = std::size_t{0}; rank < m_count; ++rank)
+        order->ranks[ranked[rank]] = rank;
+
+    m_current.store(order.get(), std::memory_order_release);
+    m_orders.push_back(std::move(order));
+}
+
+PostedWrites::~PostedWrites()
+{
+    auto write = m_head.exchange(nullptr, std::memory_order_acquire);
+
+    while (write != nullptr) {
+        const auto next = write->next;
+        write->consume(nullptr, write, false);
+        write = next;
+    }
+}
+
+bool PostedWrites::push(PostedWrite *write) noexcept
+{
+    write->next = m_head.load(std::memory_order_relaxed);
+
+    while (!m_head.compare_exchange_weak(write->next, write,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {}
+
+    return write->next == nullptr;
+}
+
+void PostedWrites::apply(QObject *object, std::size_t propertyCount)
+{
+    auto write = m_head.exchange(nullptr, std::memory_order_acquire);
+
+    // The bitset keeps its capacity, and therefore is allocated once. It's taken for
+    // the drain, as receivers of the writes might spin an event loop, and drain again.
+    auto applied = std::exchange(m_applied, {});
+    applied.assign(propertyCount, false);
+
+    while (write != nullptr) {
+        const auto index = static_cast<std::size_t>(write->propertyIndex);
+        const auto apply = !applied[index];
+        const auto next = write->next;
+
+        applied[index] = true;
+        write->consume(object, write, apply);
+        write = next;
+    }
+
+    m_applied = std::move(applied);
+}
+
+bool isSignalConnected(const QObject     *sender,
+                       const QMetaObject *metaObject,
+                       int               signalIndex) noexcept
+{
+    const auto senderPrivate = QObjectPrivate::get(sender);
+
+    if (senderPrivate->blockSig)
+        return false;
+
+    // Signal spies, like QTest's -vs option, must see all emissions.
+    if (qt_signal_spy_callback_set.loadRelaxed() != nullptr)
+        return true;
+
+    const auto offset = QMetaObjectPrivate::signalOffset(metaObject);
+    return senderPrivate->isSignalConnected(static_cast<uint>(offset + signalIndex));
+}
+
+/// Emits the held back notifications of throttled properties. There is one
+/// instance per thread, and it uses a single timer for all objects of that
+/// thread, which fires when the earliest of their intervals has passed.
+/// Each object has at most one entry, for its earliest pending notification.
+///
+/// The instance is created on demand. As it owns a timer, it must be destroyed
+/// while its thread still has an event dispatcher: Threads release it when they
+/// finish. The main thread doesn't emit `QThread::finished()`, and releases it
+/// by a post routine of `QCoreApplication` instead.
+///
+class NotificationThrottle : public QObject
+{
+public:
+    using Clock = ThrottleState::Clock;
+
+    ~NotificationThrottle() override;
+
+    [[nodiscard]] static NotificationThrottle *forCurrentThread();
+    static void releaseForCurrentThread();
+
+    void schedule(QObject *object, const MetaObjectData *metaObject,
+                  PendingNotifications *pending, Clock::time_point until);
+    void cancel(PendingNotifications *pending) noexcept;
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    struct Entry
+    {
+        QObject              *object;
+        const MetaObjectData *metaObject;
+        PendingNotifications *pending;
+    };
+
+    void emitNotifications(const Entry &entry, Clock::time_point now);
+    void restartTimer(Clock::time_point now);
+
+    std::multimap<Clock::time_point, Entry> m_entries;
+    std::vector<Entry>                      m_dueEntries;
+    Clock::time_point                       m_timerDeadline = {};
+    QBasicTimer                             m_timer;
+};
+
+namespace {
+
+thread_local NotificationThrottle *t_throttle = nullptr;
+
+} // namespace
+
+NotificationThrottle::~NotificationThrottle()
+{
+    for (const auto &entry: m_entries | std::views::values)
+        entry.pending->throttle = nullptr;
+
+    if (t_throttle == this)
+        t_throttle = nullptr;
+}
+
+NotificationThrottle *NotificationThrottle::forCurrentThread()
+{
+    if (t_throttle == nullptr) {
+        const auto thread = QThread::currentThread();
+        const auto application = QCoreApplication::instance();
+
+        t_throttle = new NotificationThrottle;
+
+        if (application == nullptr || thread == application->thread())
+            qAddPostRoutine(&NotificationThrottle::releaseForCurrentThread);
+        else
+            connect(thread, &QThread::finished, t_throttle, &QObject::deleteLater);
+    }
+
+    return t_throttle;
+}
+
+void NotificationThrottle::releaseForCurrentThread()
+{
+    delete t_throttle;
+}
+
+void NotificationThrottle::schedule(QObject *object, const MetaObjectData *metaObject,
+                                    PendingNotifications *pending, Clock::time_point until)
+{
+    if (pending->throttle != nullptr) {
+        if (pending->throttledUntil <= until)
+            return;
+
+        cancel(pending);
+    }
+
+    pending->throttle = this;
+    pending->throttledUntil = until;
+    m_entries.emplace(until, Entry{object, metaObject, pending});
+
+    // The timer only is restarted if its deadline moves forward.
+    if (!m_timer.isActive() || until < m_timerDeadline)
+        restartTimer(Clock::now());
+}
+
+void NotificationThrottle::cancel(PendingNotifications *pending) noexcept
+{
+    const auto [first, last] = m_entries.equal_range(pending->throttledUntil);
+    const auto it = std::find_if(first, last, [pending](const auto &entry) {
+        return entry.second.pending == pending;
+    });
+
+    if (it != last)
+        m_entries.erase(it);
+
+    // The object might be destroyed by the receiver of another due notification.
+    for (auto &entry: m_dueEntries) {
+        if (entry.pending == pending)
+            entry.pending = nullptr;
+    }
+
+    pending->throttle = nullptr;
+}
+
+void NotificationThrottle::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_timer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    m_timer.stop();
+
+    const auto now = Clock::now();
+    const auto end = m_entries.upper_bound(now);
+
+    // Receivers might change throttled properties again, or destroy objects.
+    // Therefore the due entries are taken before notifying anyone. They stay
+    // attached to this throttle until they are processed, so that destroyed
+    // objects still cancel their due entry, and that changes of due objects
+    // are left to the processing of their entry.
+    m_dueEntries.clear();
+
+    for (auto it = m_entries.begin(); it != end; ++it)
+        m_dueEntries.push_back(it->second);
+
+    m_entries.erase(m_entries.begin(), end);
+
+    for (auto i = 0u; i < m_dueEntries.size(); ++i) {
+        if (const auto pending = m_dueEntries[i].pending) {
+            pending->throttle = nullptr;
+            emitNotifications(m_dueEntries[i], now);
+        }
+    }
+
+    m_dueEntries.clear();
+
+    if (!m_entries.empty() && !m_timer.isActive())
+        restartTimer(Clock::now());
+}
+
+void NotificationThrottle::emitNotifications(const Entry &entry, Clock::time_point now)
+{
+    auto &throttled = entry.pending->throttled;
+    auto ready = std::vector<bool>(throttled.size(), false);
+    auto until = Clock::time_point::max();
+
+    for (auto i = 0u; i < throttled.size(); ++i) {
+        auto &state = throttled[i];
+
+        if (!state.pending)
+            continue;
+
+        if (state.until <= now) {
+            // Emitting the trailing notification starts a new interval.
+            state.until = now + state.interval;
+            state.pending = false;
+            ready[i] = true;
+        } else {
+            until = std::min(until, state.until);
+        }
+    }
+
+    // Reschedule before notifying, as the receivers might destroy the object.
+    if (until != Clock::time_point::max())
+        schedule(entry.object, entry.metaObject, entry.pending, until);
+
+    entry.metaObject->emitNotifications(entry.object, ready);
+}
+
+void NotificationThrottle::restartTimer(Clock::time_point now)
+{
+    using std::chrono::ceil;
+    using std::chrono::milliseconds;
+
+    m_timerDeadline = m_entries.begin()->first;
+    const auto timeout = std::max(ceil<milliseconds>(m_timerDeadline - now), milliseconds{0});
+    m_timer.start(static_cast<int>(timeout.count()), Qt::PreciseTimer, this);
+}
+
+PendingNotifications::~PendingNotifications()
+{
+    if (throttle != nullptr)
+        throttle->cancel(this);
+}
+
+bool throttleNotification(QObject                   *object,
+                          const MetaObjectData      *metaObject,
+                          PendingNotifications      &pending,
+                          int                       signalIndex,
+                          std::chrono::milliseconds interval)
+{
+    if (pending.throttled.empty())
+        pending.throttled.resize(metaObject->signalCount());
+
+    auto &state = pending.throttled[static_cast<std::size_t>(signalIndex)];
+    const auto now = ThrottleState::Clock::now();
+
+    state.interval = interval;
+
+    if (state.until <= now) {
+        // The leading edge: Notify immediately, and start a new interval.
+        state.until = now + interval;
+        state.pending = false;
+        return false;
+    }
+
+    if (!std::exchange(state.pending, true)) {
+        const auto throttle = NotificationThrottle::forCurrentThread();
+        throttle->schedule(object, metaObject, &pending, state.until);
+    }
+
+    return true;
+}
+
 const QMetaObject *MetaObjectBuilder::build(const QMetaType          &metaType,
                                             const QMetaObject      *superClass,
                                             const MetaObjectData   *objectData,
@@ -325,7 +831,7 @@ void MetaObjectBuilder::makeProperty(QMetaObjectBuilder &metaObject,
                                      const MemberInfo   &property)
 {
     const auto features = canonical(property.features);
-    const auto type     = QMetaType{property.valueType};
+    const auto type     = QMetaType{property.metaType};
     auto metaProperty   = metaObject.addProperty(toByteArray(property.name), type.name(), type);
 
     metaProperty.setReadable  (features & Feature::Read);
@@ -367,3 +873,23 @@ void MetaObjectBuilder::makeEnumerator(QMetaObjectBuilder &metaObject,
 }
 
 } // namespace nproperty::detail
+
+namespace nproperty {
+
+Snapshot::Snapshot(const QObject                *object,
+                   const detail::MetaObjectData *metaObject,
+                   const detail::SnapshotLayout &layout)
+    : m_metaObject{metaObject}
+    , m_layout{&layout}
+    , m_storage{static_cast<std::byte *>(::operator new(layout.size, std::align_val_t{layout.alignment}))}
+{
+    m_metaObject->copyProperties(object, *m_layout, m_storage);
+}
+
+Snapshot::~Snapshot()
+{
+    m_metaObject->destroyProperties(*m_layout, m_storage);
+    ::operator delete(m_storage, std::align_val_t{m_layout->alignment});
+}
+
+} // namespace nproperty
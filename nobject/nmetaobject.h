@@ -2,16 +2,35 @@
 #define NPROPERTY_NMETAOBJECT_H
 
 #include "nmetaobject_p.h"
+#include "nmetaobjectgenerator_p.h"
 #include "nlinenumber_p.h"
+#include "nperfecthash_p.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
 
 namespace nproperty {
 
 template<class ObjectType, class SuperType, QtInterface... Interfaces>
 class Object;
 
+class ParallelEvaluation;
+
 template<class T>
 constexpr std::size_t MaximumLineCount = 0;
 
+/// Types implementing this property system.
+///
+template<class T>
+concept NObjectType = requires { typename T::MetaObject; }
+                      && std::is_base_of_v<detail::MetaObjectData, typename T::MetaObject>;
+
 /// This class provides the introspection information for this `ObjectType`.
 ///
 /// Template arguments:
@@ -26,6 +45,9 @@ class MetaObject
     friend Object<ObjectType, SuperType>;
     friend ObjectType;
 
+    using Generator = detail::MetaObjectGenerator<ObjectType, MetaObject>;
+    friend Generator;
+
 public:
     MetaObject()
         : MetaObjectData{}
@@ -35,33 +57,187 @@ public:
     void *metaCast(ObjectType *object, const char *name) const
     {
         if (name == nullptr)
-            return nullptr; // guard strcmp() from segfault
-        if (std::strcmp(name, className()) == 0)
-            return object;
-        if (const auto result = interfaceCast(object, name))
-            return result;
+            return nullptr; // guard hashString() from segfault
+        if (const auto cast = s_castTable<>.find(name))
+            return (*cast)(object);
 
         return object->SuperType::qt_metacast(name);
     }
 
+    using CastEntry = detail::PerfectHashEntry<detail::MemberInfo::CastFunction>;
+
+    /// All names `metaCast()` resolves without asking the super class: The name of this
+    /// class, the names and IIDs of its interfaces, and the name of its super class. If the
+    /// super class also is an NObject, its entries are included; so the entire chain of
+    /// NObjects gets resolved by a single lookup.
+    ///
+    static consteval auto castEntries() noexcept
+    {
+        constexpr auto ownCount = 2 * sizeof...(Interfaces) + 2;
+
+        const auto entries = std::array<CastEntry, ownCount> {
+            CastEntry{typeName<ObjectType>(), &staticCast<ObjectType>},
+            makeInterfaceEntry<Interfaces>(&detail::MemberInfo::name)...,
+            makeInterfaceEntry<Interfaces>(&detail::MemberInfo::value)...,
+            CastEntry{typeName<SuperType>(), &staticCast<SuperType>},
+        };
+
+        if constexpr (NObjectType<SuperType>) {
+            constexpr auto inherited = SuperType::MetaObject::castEntries();
+            auto combined = std::array<CastEntry, ownCount + inherited.size()>{};
+
+            std::ranges::copy(inherited, std::ranges::copy(entries, combined.begin()).out);
+            return combined;
+        } else {
+            return entries;
+        }
+    }
+
+    /// Computes the local method index of the notification signal for the property
+    /// identified by `Label`. That's the number of notifying properties declared in
+    /// front of this property. The result is identical to `metaMethodIndexForLabel()`,
+    /// but it's known at compile time, and therefore costs nothing when emitting.
+    ///
+    template<LabelId Label>
+    static consteval int signalIndex() noexcept
+    {
+        return indexOfLabel(s_signalLabels<>, Label);
+    }
+
+    /// Computes the local index of the property identified by `Label`,
+    /// which is the number of properties declared in front of it.
+    ///
+    template<LabelId Label>
+    static consteval int propertyIndex() noexcept
+    {
+        return indexOfLabel(s_propertyLabels<>, Label);
+    }
+
+    /// Computes the index of the computed property identified by `Label`
+    /// among the computed properties of this class.
+    ///
+    template<LabelId Label>
+    static consteval int computedIndex() noexcept
+    {
+        return indexOfLabel(s_computedLabels<>, Label);
+    }
+
+    /// Reports if this class has computed properties. Only then changes
+    /// of properties must be reported to the object's `DependencyGraph`.
+    ///
+    static consteval bool hasComputedProperties() noexcept
+    {
+        return !s_computedLabels<>.empty();
+    }
+
+    /// Where a `Snapshot` of this class stores its property values: Like the members of
+    /// a struct generated from the member table, in declaration order, and each aligned
+    /// for its type. Only classes that enable snapshots instantiate this layout.
+    ///
+    static constexpr const detail::SnapshotLayout &snapshotLayout() noexcept
+    {
+        return s_snapshotLayout<>;
+    }
+
+    /// Computes the offset of the property identified by `Label` within a `Snapshot`.
+    ///
+    template<LabelId Label>
+    static consteval std::size_t snapshotOffset() noexcept
+    {
+        constexpr auto index = propertyIndex<Label>();
+        static_assert(index >= 0, "There is no property with this label");
+
+        return s_snapshotOffsets<>.offsets[static_cast<std::size_t>(index)];
+    }
+
+    /// Reports the offset of the property identified by `Label` within its object,
+    /// if the compiler was able to compute it at compile time. Otherwise the offset
+    /// must be resolved at runtime by `memberOffset()`.
+    ///
+    template<LabelId Label>
+    static consteval std::optional<quintptr> staticMemberOffset() noexcept
+    {
+        const auto &members = memberTable();
+        const auto it = std::lower_bound(members.cbegin(), members.cend(), Label,
+                                         [](const detail::MemberInfo &member, LabelId label) {
+            return member.label < label;
+        });
+
+        if (it != members.cend() && it->label == Label
+            && it->type == detail::MemberInfo::Type::Property)
+            return it->offset;
+
+        return {};
+    }
+
+    /// Returns the metaobject generated at compile time for this class,
+    /// or `nullptr` if the generator doesn't support this version of Qt.
+    ///
+    static const QMetaObject *generatedMetaObject() noexcept
+    {
+        if constexpr (Generator::isSupported()) {
+            static const auto s_metaObject = makeGeneratedMetaObject();
+            return &s_metaObject;
+        } else {
+            return nullptr;
+        }
+    }
+
+    /// Creates a new metaobject for this class from the data generated at compile time,
+    /// like `generatedMetaObject()` does once. The tables are shared, not copied. If the
+    /// generator doesn't support this version of Qt, the metaobject is empty.
+    ///
+    [[nodiscard]] static QMetaObject makeGeneratedMetaObject() noexcept
+    {
+        if constexpr (Generator::isSupported()) {
+            return QMetaObject{{
+                &SuperType::staticMetaObject,
+                Generator::stringData(),
+                Generator::data(),
+                &MetaObject::staticMetaCall,
+                nullptr,
+                Generator::metaTypes(),
+                nullptr,
+            }};
+        } else {
+            return {};
+        }
+    }
+
+    /// Builds a new metaobject for this class at runtime, using `QMetaObjectBuilder`.
+    /// The caller takes ownership and must release the result by `std::free()`.
+    ///
+    [[nodiscard]] static const QMetaObject *buildMetaObject()
+    {
+        return detail::MetaObjectBuilder::build(QMetaType::fromType<ObjectType>(),
+                                                &SuperType::staticMetaObject,
+                                                &ObjectType::staticMetaObject,
+                                                &MetaObject::staticMetaCall);
+    }
+
 private:
     const QMetaObject *build()
     {
         static const auto s_metaObject = [](MetaObject *data) {
-            constexpr auto lineCount = std::max(sizeof(ObjectType), MaximumLineCount<ObjectType>);
-            constexpr auto lines = std::make_integer_sequence<LabelId, lineCount>();
+            constexpr auto lines = std::make_integer_sequence<LabelId, lineCount()>();
             registerMembers<ObjectType::lineOffset()>(data, lines);
             data->validateMembers();
+            data->buildLookupTables();
+
+            if (const auto metaObject = generatedMetaObject())
+                return metaObject;
 
-            return detail::MetaObjectBuilder::build(QMetaType::fromType<ObjectType>(),
-                                                    &SuperType::staticMetaObject,
-                                                    &ObjectType::staticMetaObject,
-                                                    &MetaObject::staticMetaCall);
+            return buildMetaObject();
         }(this);
 
         return s_metaObject;
     }
 
+    static constexpr std::size_t lineCount() noexcept
+    {
+        return std::max(sizeof(ObjectType), MaximumLineCount<ObjectType>);
+    }
+
     template<LabelId... Indices>
     using LabelSequence = std::integer_sequence<LabelId, Indices...>;
 
@@ -80,6 +256,187 @@ private:
             data->emplace(ObjectType::member(detail::Tag<Label>{}));
     }
 
+    /// All members of this class, in declaration order. This table only exists at compile time.
+    ///
+    static consteval const auto &memberTable() noexcept
+    {
+        return s_memberTable<>;
+    }
+
+    static constexpr bool isMember(const detail::MemberInfo &member) noexcept
+    {
+        return static_cast<bool>(member);
+    }
+
+    static constexpr bool isProperty(const detail::MemberInfo &member) noexcept
+    {
+        return member.type == detail::MemberInfo::Type::Property;
+    }
+
+    static constexpr bool isSignal(const detail::MemberInfo &member) noexcept
+    {
+        return isProperty(member) && canonical(member.features).contains(Feature::Notify);
+    }
+
+    static constexpr bool isComputed(const detail::MemberInfo &member) noexcept
+    {
+        return isProperty(member) && member.features.contains(Feature::Computed);
+    }
+
+    /// The labels of all members matching `predicate`, e.g. of all notifying properties.
+    /// The position of a label in this sorted array is the local index of its member.
+    ///
+    template<std::size_t Count>
+    static consteval auto findLabels(bool (*predicate)(const detail::MemberInfo &)) noexcept
+    {
+        auto labels = std::array<LabelId, Count>{};
+        auto count = std::size_t{0};
+
+        for (const auto &member: s_memberTable<>) {
+            if (predicate(member))
+                labels[count++] = member.label;
+        }
+
+        return labels;
+    }
+
+    template<std::size_t Count>
+    static consteval int indexOfLabel(const std::array<LabelId, Count> &labels, LabelId label) noexcept
+    {
+        const auto it = std::lower_bound(labels.cbegin(), labels.cend(), label);
+
+        if (it != labels.cend() && *it == label)
+            return static_cast<int>(it - labels.cbegin());
+
+        return -1;
+    }
+
+    template<std::size_t Count>
+    static consteval auto findMembers() noexcept
+    {
+        auto indices = std::array<std::size_t, Count>{};
+        auto count = std::size_t{0};
+
+        for (auto i = std::size_t{0}; i < s_lineTable<>.size(); ++i) {
+            if (isMember(s_lineTable<>[i]))
+                indices[count++] = i;
+        }
+
+        return indices;
+    }
+
+    template<std::size_t... Indices>
+    static consteval auto compactMemberTable(const std::index_sequence<Indices...> &) noexcept
+    {
+        return std::array<detail::MemberInfo, sizeof...(Indices)> {
+            s_lineTable<>[s_memberIndices<>[Indices]]...
+        };
+    }
+
+    /// All members of this class, indexed by their line number relative to `lineOffset()`.
+    ///
+    template<quintptr Offset, LabelId... Labels>
+    static consteval auto makeMemberTable(const LabelSequence<Labels...> &) noexcept
+    {
+        // An array instead of a fold expression to not hit
+        // the compiler's nesting limits for fold expressions.
+        return std::array<detail::MemberInfo, sizeof...(Labels)> {
+            makeMemberTableEntry<Offset + Labels>()...
+        };
+    }
+
+    template<LabelId Line>
+    static consteval detail::MemberInfo makeMemberTableEntry() noexcept
+    {
+        if constexpr (hasMember<ObjectType, Line>())
+            return ObjectType::member(detail::Tag<Line>{});
+        else
+            return {};
+    }
+
+    /// The member tables are variable templates, so that they are computed only once
+    /// per class, when used first. A function would get re-evaluated by each caller,
+    /// which makes compile time grow quadratically with the number of members.
+    ///
+    template<typename = void>
+    static constexpr auto s_lineTable = makeMemberTable<ObjectType::lineOffset()>(
+        std::make_integer_sequence<LabelId, lineCount()>());
+
+    template<typename = void>
+    static constexpr auto s_memberIndices = findMembers<static_cast<std::size_t>(
+        std::ranges::count_if(s_lineTable<>, isMember))>();
+
+    template<typename = void>
+    static constexpr auto s_memberTable = compactMemberTable(
+        std::make_index_sequence<s_memberIndices<>.size()>());
+
+    template<typename = void>
+    static constexpr auto s_signalLabels = findLabels<static_cast<std::size_t>(
+        std::ranges::count_if(s_memberTable<>, isSignal))>(isSignal);
+
+    template<typename = void>
+    static constexpr auto s_propertyLabels = findLabels<static_cast<std::size_t>(
+        std::ranges::count_if(s_memberTable<>, isProperty))>(isProperty);
+
+    template<typename = void>
+    static constexpr auto s_computedLabels = findLabels<static_cast<std::size_t>(
+        std::ranges::count_if(s_memberTable<>, isComputed))>(isComputed);
+
+    static consteval auto makeSnapshotOffsets() noexcept
+    {
+        auto layout = detail::SnapshotOffsets<s_propertyLabels<>.size()>{};
+        auto index = std::size_t{0};
+
+        for (const auto &member: s_memberTable<>) {
+            if (!isProperty(member))
+                continue;
+
+            const auto alignment = std::size_t{member.metaType->alignment};
+            const auto offset = (layout.size + alignment - 1) / alignment * alignment;
+
+            layout.offsets[index++] = offset;
+            layout.size = offset + member.metaType->size;
+            layout.alignment = std::max(layout.alignment, alignment);
+        }
+
+        return layout;
+    }
+
+    template<typename = void>
+    static constexpr auto s_snapshotOffsets = makeSnapshotOffsets();
+
+    template<typename = void>
+    static constexpr auto s_snapshotLayout = detail::SnapshotLayout{
+        s_snapshotOffsets<>.offsets, s_snapshotOffsets<>.size, s_snapshotOffsets<>.alignment};
+
+    template<class T>
+    static constexpr std::string_view typeName() noexcept
+    {
+        return QtPrivate::qMetaTypeInterfaceForType<T>()->name;
+    }
+
+    template<class T>
+    static void *staticCast(QObject *object) noexcept
+    {
+        return static_cast<T *>(static_cast<ObjectType *>(object));
+    }
+
+    template<QtInterface Interface>
+    static constexpr CastEntry makeInterfaceEntry(std::string_view detail::MemberInfo::*key) noexcept
+    {
+        const auto interfaceInfo = detail::MemberInfo::makeInterface<Interface, ObjectType>();
+        return {interfaceInfo.*key, interfaceInfo.metacast};
+    }
+
+    static consteval auto makeCastTable() noexcept
+    {
+        constexpr auto entries = castEntries();
+        return detail::PerfectHashTable<detail::MemberInfo::CastFunction, entries.size()>{entries};
+    }
+
+    template<typename = void>
+    static constexpr auto s_castTable = makeCastTable();
+
     template<typename Interface>
     static void registerInterface(MetaObject *data)
     {
@@ -92,6 +449,443 @@ private:
     }
 };
 
+/// An immutable copy of all property values of an object, taken at a consistent
+/// point: Snapshots are published when the outermost `NotificationBatch` of an
+/// object closes, after each change made without a batch, and when
+/// `Object::publishSnapshot()` is called. They are shared by reference counting,
+/// and can be read from any thread.
+///
+/// The values are stored like the members of a struct generated from the member table
+/// of the object's class, see `MetaObject::snapshotLayout()`. So reading a value costs
+/// no lookup, just an offset known at compile time.
+///
+class Snapshot
+{
+public:
+    Snapshot(const QObject                *object,
+             const detail::MetaObjectData *metaObject,
+             const detail::SnapshotLayout &layout);
+    ~Snapshot();
+
+    Snapshot(const Snapshot &) = delete;
+    Snapshot &operator=(const Snapshot &) = delete;
+
+    /// Reads the value of `Property`, as it was when this snapshot was taken.
+    ///
+    template<auto Property>
+    [[nodiscard]] const auto &value() const noexcept
+    {
+        using PropertyType = detail::DataMemberType<Property>;
+        using   ObjectType = typename PropertyType::ObjectType;
+        using    ValueType = typename PropertyType::ValueType;
+
+        constexpr auto offset = ObjectType::MetaObject::template snapshotOffset<PropertyType::label()>();
+
+        // Snapshots only hold the properties declared by the class of the object.
+        Q_ASSERT(m_metaObject == &ObjectType::staticMetaObject);
+
+        return *std::launder(reinterpret_cast<const ValueType *>(m_storage + offset));
+    }
+
+private:
+    const detail::MetaObjectData *m_metaObject;
+    const detail::SnapshotLayout *m_layout;
+    std::byte                    *m_storage;
+};
+
+/// One bit per property of an object, indexed by local property index.
+/// The index of the matching `QMetaProperty` is `propertyOffset() + index`.
+///
+class PropertyBits
+{
+public:
+    using Word = std::uint64_t;
+
+    PropertyBits() noexcept = default;
+    explicit PropertyBits(std::size_t size)
+        : m_words((size + WordBits - 1) / WordBits, Word{0})
+    {}
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    void set(std::size_t index) noexcept
+    {
+        m_words[index / WordBits] |= Word{1} << (index % WordBits);
+    }
+
+    void reset(std::size_t index) noexcept
+    {
+        m_words[index / WordBits] &= ~(Word{1} << (index % WordBits));
+    }
+
+    [[nodiscard]] bool test(std::size_t index) const noexcept
+    {
+        return (m_words[index / WordBits] >> (index % WordBits)) & 1;
+    }
+
+    void clear() noexcept { std::ranges::fill(m_words, Word{0}); }
+
+    /// Sets each bit that is set in `other`, which must have the same size.
+    ///
+    PropertyBits &operator|=(const PropertyBits &other) noexcept
+    {
+        Q_ASSERT(other.m_words.size() == m_words.size());
+
+        for (auto i = std::size_t{0}; i < m_words.size(); ++i)
+            m_words[i] |= other.m_words[i];
+
+        return *this;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return std::ranges::all_of(m_words, [](Word word) { return word == 0; });
+    }
+
+    [[nodiscard]] int count() const noexcept
+    {
+        auto count = 0;
+
+        for (const auto word: m_words)
+            count += std::popcount(word);
+
+        return count;
+    }
+
+    /// Returns the index of the first set bit at or after `index`, or `npos`. Unlike
+    /// `forEach()` this observes bits that are set while iterating.
+    ///
+    [[nodiscard]] std::size_t findNext(std::size_t index) const noexcept
+    {
+        for (auto i = index / WordBits; i < m_words.size(); ++i) {
+            auto word = m_words[i];
+
+            if (i == index / WordBits)
+                word &= ~Word{0} << (index % WordBits);
+            if (word != 0)
+                return i * WordBits + static_cast<std::size_t>(std::countr_zero(word));
+        }
+
+        return npos;
+    }
+
+    /// Calls `function` with the index of each set bit, in ascending order.
+    ///
+    template<std::invocable<int> Function>
+    void forEach(Function &&function) const
+    {
+        for (auto i = std::size_t{0}; i < m_words.size(); ++i) {
+            for (auto word = m_words[i]; word != 0; word &= word - 1) {
+                const auto bit = static_cast<std::size_t>(std::countr_zero(word));
+                std::invoke(function, static_cast<int>(i * WordBits + bit));
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t WordBits = std::numeric_limits<Word>::digits;
+
+    std::vector<Word> m_words;
+};
+
+namespace detail {
+
+/// The latest snapshot of an object. Reading it is wait-free, as long as the platform
+/// increments atomic counters without retrying: A reader announces itself in the counter
+/// of the current epoch, loads the snapshot, takes a reference, and leaves the counter.
+/// It never waits, neither for the object's thread, nor for other readers.
+///
+/// Only the object's thread replaces the snapshot. Like RCU it then waits, until no reader
+/// still might be taking a reference to the previous snapshot: It flips the epoch twice, and
+/// each time waits until the counter of the previous epoch drains. New readers already use
+/// the other counter, so this only waits for readers that started before. Then it drops its
+/// own reference, and the previous snapshot is released when its last reader drops it.
+///
+class SnapshotPointer
+{
+public:
+    using Pointer = std::shared_ptr<const Snapshot>;
+
+    SnapshotPointer() noexcept = default;
+    ~SnapshotPointer() { delete m_current.load(std::memory_order_relaxed); }
+
+    SnapshotPointer(const SnapshotPointer &) = delete;
+    SnapshotPointer &operator=(const SnapshotPointer &) = delete;
+
+    [[nodiscard]] Pointer load() const noexcept
+    {
+        auto &readers = m_readers[m_epoch.load() & 1];
+
+        readers.fetch_add(1);
+        const auto current = m_current.load();
+        auto pointer = current ? *current : Pointer{};
+        readers.fetch_sub(1);
+
+        return pointer;
+    }
+
+    void store(Pointer pointer)
+    {
+        const auto previous = m_current.exchange(new Pointer{std::move(pointer)});
+
+        if (previous == nullptr)
+            return;
+
+        for (auto flip = 0; flip < 2; ++flip) {
+            const auto epoch = m_epoch.fetch_add(1);
+
+            while (m_readers[epoch & 1].load() != 0)
+                std::this_thread::yield();
+        }
+
+        delete previous;
+    }
+
+    /// Publishes a new snapshot of `object`.
+    ///
+    void publish(const QObject *object, const MetaObjectData *metaObject, const SnapshotLayout &layout)
+    {
+        store(std::make_shared<const Snapshot>(object, metaObject, layout));
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept { return layout != nullptr; }
+
+    /// Set by `Object::enableSnapshots()`. Only accessed by the object's thread.
+    const SnapshotLayout *layout = nullptr;
+
+private:
+    std::atomic<const Pointer *>                     m_current = nullptr;
+    std::atomic<std::size_t>                         m_epoch   = 0;
+    mutable std::array<std::atomic<std::size_t>, 2> m_readers = {};
+};
+
+/// The dependencies of the computed properties of an object: For each computed property
+/// the properties it has read when it was computed last, and for each property the
+/// computed properties that have read it. Until computed first, a computed property
+/// depends on all properties. The graph is allocated once per object. Computing a
+/// property and propagating changes just clear and set bits, and don't allocate.
+/// The topological order is shared by all objects of the class, see `ComputedRanking`.
+///
+class DependencyGraph
+{
+public:
+    /// Whether `markDependents()` also marks the computed properties not computed yet.
+    enum class Uncomputed { Excluded, Included };
+
+    DependencyGraph(ComputedRanking &ranking, std::size_t computedCount, std::size_t propertyCount)
+        : m_ranking{&ranking}
+        , m_dependencies(computedCount, PropertyBits{propertyCount})
+        , m_dependents(propertyCount, PropertyBits{computedCount})
+        , m_uncomputed{computedCount}
+        , m_dirty{computedCount}
+        , m_changed{computedCount}
+    {
+        for (auto i = std::size_t{0}; i < computedCount; ++i)
+            m_uncomputed.set(i);
+    }
+
+    /// Starts computing the property at `computedIndex`. From now on the properties read
+    /// are recorded as its dependencies. Returns the evaluation this one interrupts.
+    ///
+    [[nodiscard]] int beginEvaluation(int computedIndex) noexcept
+    {
+        const auto index = static_cast<std::size_t>(computedIndex);
+
+        m_dependencies[index].forEach([this, index](int propertyIndex) {
+            m_dependents[static_cast<std::size_t>(propertyIndex)].reset(index);
+        });
+
+        m_dependencies[index].clear();
+        m_uncomputed.reset(index);
+
+        return std::exchange(m_evaluating, computedIndex);
+    }
+
+    void endEvaluation(int interrupted) noexcept { m_evaluating = interrupted; }
+
+    /// The computed property being computed now, or -1.
+    [[nodiscard]] int evaluating() const noexcept { return m_evaluating; }
+
+    /// Records that the property at `propertyIndex` was read by the property being computed.
+    /// If that's a computed property, its `computedIndex` is passed too, otherwise -1,
+    /// and the read is also recorded by the `ComputedRanking` of the class.
+    ///
+    void record(std::size_t propertyIndex, int computedIndex)
+    {
+        if (m_evaluating >= 0) {
+            const auto index = static_cast<std::size_t>(m_evaluating);
+            m_dependencies[index].set(propertyIndex);
+            m_dependents[propertyIndex].set(index);
+
+            if (computedIndex >= 0)
+                m_ranking->record(index, static_cast<std::size_t>(computedIndex));
+        }
+    }
+
+    /// The computed index of the property in `bits` that comes next in `order`,
+    /// starting at `rank`, or `PropertyBits::npos` if there is none.
+    ///
+    [[nodiscard]] static std::size_t findNext(const ComputedRanking::Order *order,
+                                              const PropertyBits &bits, std::size_t rank) noexcept
+    {
+        if (order == nullptr)
+            return bits.findNext(rank);
+
+        for (; rank < order->computedIndices.size(); ++rank) {
+            if (bits.test(order->computedIndices[rank]))
+                return order->computedIndices[rank];
+        }
+
+        return PropertyBits::npos;
+    }
+
+    /// Marks the computed properties that have read the property at `propertyIndex` dirty.
+    ///
+    void markDependents(std::size_t propertyIndex, Uncomputed uncomputed) noexcept
+    {
+        m_dirty |= m_dependents[propertyIndex];
+
+        if (uncomputed == Uncomputed::Included)
+            m_dirty |= m_uncomputed;
+    }
+
+    /// The computed properties that must be updated,
+    /// and those that must be notified, by computed index.
+    ///
+    [[nodiscard]] PropertyBits &dirty() noexcept { return m_dirty; }
+    [[nodiscard]] PropertyBits &changed() noexcept { return m_changed; }
+
+    /// While deferred, changes only mark the direct dependents dirty,
+    /// and `ParallelEvaluation` updates them later. See there.
+    ///
+    [[nodiscard]] bool isDeferred() const noexcept { return m_deferred; }
+    void setDeferred(bool deferred) noexcept { m_deferred = deferred; }
+
+private:
+    ComputedRanking          *m_ranking;
+    std::vector<PropertyBits> m_dependencies;
+    std::vector<PropertyBits> m_dependents;
+    PropertyBits              m_uncomputed;
+    PropertyBits              m_dirty;
+    PropertyBits              m_changed;
+    int                       m_evaluating = -1;
+    bool                      m_deferred = false;
+};
+
+/// The values of the sparse properties of an object that differ from their default:
+/// A flat map sorted by local property index, which is allocated when the first
+/// value gets stored. See `Feature::Sparse`. The values are moved when other values
+/// get inserted or erased, therefore references are only valid until then.
+///
+class SparseValues
+{
+public:
+    [[nodiscard]] const QVariant *find(int propertyIndex) const noexcept
+    {
+        const auto it = std::ranges::lower_bound(m_entries, propertyIndex, {}, &Entry::propertyIndex);
+        return it != m_entries.end() && it->propertyIndex == propertyIndex ? &it->value : nullptr;
+    }
+
+    /// Stores `value` at `propertyIndex`, replacing the value stored before.
+    ///
+    template<typename Value>
+    void store(int propertyIndex, Value value)
+    {
+        const auto it = std::ranges::lower_bound(m_entries, propertyIndex, {}, &Entry::propertyIndex);
+
+        if (it != m_entries.end() && it->propertyIndex == propertyIndex)
+            *static_cast<Value *>(it->value.data()) = std::move(value);
+        else
+            m_entries.insert(it, {propertyIndex, QVariant::fromValue(value)});
+    }
+
+    void erase(int propertyIndex) noexcept
+    {
+        const auto it = std::ranges::lower_bound(m_entries, propertyIndex, {}, &Entry::propertyIndex);
+
+        if (it != m_entries.end() && it->propertyIndex == propertyIndex)
+            m_entries.erase(it);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        int      propertyIndex;
+        QVariant value;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+/// The state of an object that only objects using certain features need: Batched,
+/// coalesced and throttled notifications, change tracking, computed properties, sparse
+/// properties, snapshots, and posted writes. It is allocated when the first of these
+/// features gets used, so that other objects only pay for a single pointer. Other
+/// threads post writes and read snapshots, therefore it is installed atomically.
+///
+struct ObjectExtension
+{
+    PendingNotifications           pendingNotifications;
+    std::optional<PropertyBits>    changedProperties;
+    std::optional<DependencyGraph> dependencyGraph;
+    SparseValues                   sparseValues;
+    SnapshotPointer                snapshot;
+    PostedWrites                   postedWrites;
+};
+
+} // namespace detail
+
+/// Holds back the change notifications of an object while it exists. When the
+/// outermost batch of an object is destroyed, each property that was changed
+/// meanwhile is notified exactly once, in declaration order, and with its final
+/// value. This way receivers neither recompute for each single change, nor do they
+/// observe half-updated state. Batches must not outlive their object.
+///
+/// Use `Object::batchNotifications()` to create batches.
+///
+class NotificationBatch
+{
+public:
+    NotificationBatch(QObject                      *object,
+                      const detail::MetaObjectData *metaObject,
+                      detail::PendingNotifications *pending,
+                      detail::SnapshotPointer      *snapshot) noexcept
+        : m_object{object}
+        , m_metaObject{metaObject}
+        , m_pending{pending}
+        , m_snapshot{snapshot}
+    {
+        if (m_pending->depth++ == 0)
+            m_pending->changed.assign(m_metaObject->signalCount(), false);
+    }
+
+    ~NotificationBatch()
+    {
+        if (--m_pending->depth == 0) {
+            // Receivers in other threads might read the snapshot
+            // when notified. Therefore it is published first.
+            if (m_snapshot->isEnabled())
+                m_snapshot->publish(m_object, m_metaObject, *m_snapshot->layout);
+
+            // Receivers might start new batches, or change properties. Therefore
+            // the pending notifications are taken before notifying anyone.
+            const auto changed = std::exchange(m_pending->changed, {});
+            m_metaObject->emitNotifications(m_object, changed);
+        }
+    }
+
+    NotificationBatch(const NotificationBatch &) = delete;
+    NotificationBatch &operator=(const NotificationBatch &) = delete;
+
+private:
+    QObject                      *m_object;
+    const detail::MetaObjectData *m_metaObject;
+    detail::PendingNotifications *m_pending;
+    detail::SnapshotPointer      *m_snapshot;
+};
+
 /// This mixin provides convenience methods for classes implementing
 /// this property system. Most likely all them then can mix merged
 /// into the N_OBJECT macro, and this intermediate class can be
@@ -106,6 +900,7 @@ class Object
 {
     friend nproperty::MetaObject<ObjectType, SuperType, Interfaces...>;
     friend nproperty::detail::MemberInfo;
+    friend nproperty::ParallelEvaluation;
 
 public:
     using MetaObject = nproperty::MetaObject<ObjectType, SuperType, Interfaces...>;
@@ -113,6 +908,85 @@ public:
 
     using SuperType::SuperType;
 
+    ~Object() override
+    {
+        // Receivers of destroyed() and children destroyed by ~QObject() still might
+        // access the object, and then must find no extension, instead of a dangling one.
+        delete m_extension.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    /// Holds back change notifications while the returned batch exists.
+    /// See `NotificationBatch` for details. Batches can be nested.
+    ///
+    [[nodiscard]] NotificationBatch batchNotifications()
+    {
+        auto &extension = this->extension();
+        return {this, &ObjectType::staticMetaObject, &extension.pendingNotifications, &extension.snapshot};
+    }
+
+    /// Publishes a snapshot of all properties now, and after each change from now on:
+    /// When the outermost batch of notifications closes, or immediately for changes
+    /// made without a batch. This must be called by the object's thread, before other
+    /// threads read snapshots.
+    ///
+    void enableSnapshots()
+    {
+        extension().snapshot.layout = &MetaObject::snapshotLayout();
+        publishSnapshot();
+    }
+
+    /// Publishes a snapshot of all properties now.
+    ///
+    void publishSnapshot()
+    {
+        extension().snapshot.publish(this, &ObjectType::staticMetaObject, MetaObject::snapshotLayout());
+    }
+
+    /// Records which properties get changed from now on, for incremental
+    /// serialization and synchronization. See `changedProperties()`.
+    ///
+    void enableChangeTracking()
+    {
+        if (auto &changed = extension().changedProperties; !changed.has_value())
+            changed.emplace(ObjectType::staticMetaObject.localPropertyCount());
+    }
+
+    /// Returns the properties changed since tracking was enabled,
+    /// or since `clearChangedProperties()` was called last.
+    ///
+    [[nodiscard]] const PropertyBits &changedProperties() const noexcept
+    {
+        static const auto s_untracked = PropertyBits{};
+
+        if (const auto extension = findExtension(); extension && extension->changedProperties)
+            return *extension->changedProperties;
+
+        return s_untracked;
+    }
+
+    void clearChangedProperties() noexcept
+    {
+        if (const auto extension = findExtension(); extension && extension->changedProperties)
+            extension->changedProperties->clear();
+    }
+
+    /// Returns how many sparse properties of this object differ from their default.
+    ///
+    [[nodiscard]] std::size_t storedSparseValueCount() const noexcept
+    {
+        const auto extension = findExtension();
+        return extension ? extension->sparseValues.size() : 0;
+    }
+
+    /// Returns the latest published snapshot, or `nullptr` if there is none.
+    /// This can be called by any thread.
+    ///
+    [[nodiscard]] std::shared_ptr<const Snapshot> snapshot() const noexcept
+    {
+        const auto extension = findExtension();
+        return extension ? extension->snapshot.load() : nullptr;
+    }
+
 protected:
     template <typename Value, auto Name, FeatureSet Features = Feature::Read>
     using Property = nproperty::Property<ObjectType, Value, Name, Features>;
@@ -125,17 +999,20 @@ protected:
     template<typename Value, LabelId Label>
     void activateSignal(Value value)
     {
+        constexpr auto methodIndex = MetaObject::template signalIndex<Label>();
+        static_assert(methodIndex >= 0, "There is no notifying property with this label");
+
         const auto metaObject = &ObjectType::staticMetaObject;
-        const auto methodIndex = metaObject->metaMethodIndexForLabel(Label);
               auto metaCallArgs = std::array<void *, 2> { nullptr, &value };
 
         QMetaObject::activate(this, metaObject, methodIndex, metaCallArgs.data());
     }
 
     template<auto Property>
-    static consteval auto makeProperty(std::string_view name) noexcept
+    static consteval auto makeProperty(std::string_view name,
+                                       std::optional<quintptr> offset = {}) noexcept
     {
-        return detail::MemberInfo::makeProperty<Property>(std::move(name));
+        return detail::MemberInfo::makeProperty<Property>(std::move(name), std::move(offset));
     }
 
     static consteval auto makeClassInfo(std::string_view name, std::string_view value,
@@ -165,15 +1042,298 @@ protected:
     }
 
 public: // FIXME: make signalProxy() protected again
+    /// Records the change of the property identified by `Label`, if notifications
+    /// are held back by a `NotificationBatch`. Otherwise this returns `false`, and
+    /// the caller must notify immediately.
+    ///
+    template<LabelId Label>
+    bool deferNotification() noexcept
+    {
+        const auto extension = findExtension();
+
+        if (extension == nullptr || extension->pendingNotifications.depth == 0)
+            return false;
+
+        constexpr auto methodIndex = MetaObject::template signalIndex<Label>();
+        static_assert(methodIndex >= 0, "There is no notifying property with this label");
+
+        extension->pendingNotifications.changed[methodIndex] = true;
+        return true;
+    }
+
+    /// Records the change of the property identified by `Label`, and schedules
+    /// its notification for the next iteration of the event loop, unless that
+    /// already happened for some other change of this object.
+    ///
+    template<LabelId Label>
+    void coalesceNotification()
+    {
+        constexpr auto methodIndex = MetaObject::template signalIndex<Label>();
+        static_assert(methodIndex >= 0, "There is no notifying property with this label");
+
+        auto &pending = pendingNotifications();
+
+        if (pending.coalesced.empty())
+            pending.coalesced.assign(ObjectType::staticMetaObject.signalCount(), false);
+
+        pending.coalesced[methodIndex] = true;
+
+        if (!std::exchange(pending.scheduled, true)) {
+            QMetaObject::invokeMethod(this, [this] {
+                emitCoalescedNotifications();
+            }, Qt::QueuedConnection);
+        }
+    }
+
+    /// Returns `false` if the property identified by `Label` may notify immediately.
+    /// Otherwise its notification is held back until `interval` has passed since the
+    /// previous one, and then emitted with the latest value.
+    ///
+    template<LabelId Label>
+    bool throttleNotification(std::chrono::milliseconds interval)
+    {
+        constexpr auto methodIndex = MetaObject::template signalIndex<Label>();
+        static_assert(methodIndex >= 0, "There is no notifying property with this label");
+
+        return detail::throttleNotification(this, &ObjectType::staticMetaObject,
+                                            pendingNotifications(), methodIndex, interval);
+    }
+
+    /// Reports if `enableChangeTracking()` was called.
+    ///
+    [[nodiscard]] bool isChangeTrackingEnabled() const noexcept
+    {
+        const auto extension = findExtension();
+        return extension && extension->changedProperties.has_value();
+    }
+
+    /// Returns the default value declared for the property identified by `Label`, see
+    /// `N_PROPERTY_WITH_DEFAULT()`, or a value-initialized `Value` if there is none.
+    ///
+    template<LabelId Label, typename Value>
+    [[nodiscard]] static Value declaredDefaultValue()
+    {
+        // the fallback declared by N_OBJECT returns void for properties without default
+        if constexpr (std::is_void_v<decltype(ObjectType::defaultValue(detail::Tag<Label>{}))>)
+            return Value{};
+        else
+            return ObjectType::defaultValue(detail::Tag<Label>{});
+    }
+
+    /// Reports if changes of properties must be recorded,
+    /// because change tracking or snapshots are enabled.
+    ///
+    [[nodiscard]] bool isRecordingChanges() const noexcept
+    {
+        const auto extension = findExtension();
+        return extension && (extension->changedProperties.has_value() || extension->snapshot.isEnabled());
+    }
+
+    /// Publishes a snapshot after a change made without a batch, if snapshots are enabled.
+    /// Changes made within a batch get published when the outermost batch closes.
+    ///
+    void publishUnbatchedChange()
+    {
+        const auto extension = findExtension();
+
+        if (extension && extension->snapshot.isEnabled() && extension->pendingNotifications.depth == 0)
+            extension->snapshot.publish(this, &ObjectType::staticMetaObject, *extension->snapshot.layout);
+    }
+
+    /// Records the change of the property identified by `Label`, if tracking is enabled.
+    ///
+    template<LabelId Label>
+    void markPropertyChanged() noexcept
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        if (const auto extension = findExtension(); extension && extension->changedProperties)
+            extension->changedProperties->set(propertyIndex);
+    }
+
+    /// Returns the stored value of the sparse property identified by `Label`,
+    /// or `nullptr` if the property has its default value.
+    ///
+    template<LabelId Label>
+    [[nodiscard]] const QVariant *findSparseValue() const noexcept
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        const auto extension = findExtension();
+        return extension ? extension->sparseValues.find(propertyIndex) : nullptr;
+    }
+
+    /// Stores `value` for the sparse property identified by `Label`.
+    ///
+    template<LabelId Label, typename Value>
+    void storeSparseValue(Value value)
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        extension().sparseValues.store(propertyIndex, std::move(value));
+    }
+
+    template<LabelId Label>
+    void eraseSparseValue() noexcept
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        if (const auto extension = findExtension())
+            extension->sparseValues.erase(propertyIndex);
+    }
+
+    /// Starts computing the computed property identified by `Label`, and returns
+    /// the evaluation it interrupts, which must be passed to `endEvaluation()`.
+    /// See `DependencyGraph::beginEvaluation()`.
+    ///
+    template<LabelId Label>
+    [[nodiscard]] int beginEvaluation()
+    {
+        constexpr auto computedIndex = MetaObject::template computedIndex<Label>();
+        static_assert(computedIndex >= 0, "There is no computed property with this label");
+
+        return dependencyGraph().beginEvaluation(computedIndex);
+    }
+
+    void endEvaluation(int interrupted) noexcept
+    {
+        findExtension()->dependencyGraph->endEvaluation(interrupted);
+    }
+
+    /// Records that the property identified by `Label` is read by
+    /// the computed property being computed now, if there is one.
+    ///
+    template<LabelId Label>
+    void recordDependency() const
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        if (const auto extension = findExtension(); extension && extension->dependencyGraph)
+            extension->dependencyGraph->record(propertyIndex, MetaObject::template computedIndex<Label>());
+    }
+
+    /// Updates the computed properties that have read the property identified by `Label`.
+    /// See `MetaObjectData::invalidateDependents()`.
+    ///
+    template<LabelId Label>
+    void invalidateDependents()
+    {
+        constexpr auto propertyIndex = MetaObject::template propertyIndex<Label>();
+        static_assert(propertyIndex >= 0, "There is no property with this label");
+
+        ObjectType::staticMetaObject.invalidateDependents(this, dependencyGraph(), propertyIndex);
+    }
+
+    /// Notifies the computed properties changed by `invalidateDependents()`.
+    ///
+    void notifyDependents()
+    {
+        if (const auto extension = findExtension(); extension && extension->dependencyGraph)
+            ObjectType::staticMetaObject.notifyDependents(this, *extension->dependencyGraph);
+    }
+
+    /// Queues a write posted by `Property::post()`, which might be called by any
+    /// thread. The first write since the last drain schedules the next drain.
+    ///
+    void postWrite(detail::PostedWrite *write)
+    {
+        if (extension().postedWrites.push(write)) {
+            QMetaObject::invokeMethod(this, [this] {
+                applyPostedWrites();
+            }, Qt::QueuedConnection);
+        }
+    }
+
+    /// Reports if emitting the notification signal of the property identified
+    /// by `Label` would have any effect, that is if there are any receivers.
+    ///
+    template<LabelId Label>
+    bool isNotifySignalConnected() const noexcept
+    {
+        constexpr auto methodIndex = MetaObject::template signalIndex<Label>();
+        static_assert(methodIndex >= 0, "There is no notifying property with this label");
+
+        return detail::isSignalConnected(this, &ObjectType::staticMetaObject, methodIndex);
+    }
+
     template<typename Value, LabelId Label, FeatureSet Features>
     static detail::MemberFunction<ObjectType, void, Value>
     signalProxy(const Property<Value, Label, Features> * = nullptr)
     {
-        if (Q_LIKELY(canonical(Features).contains(Feature::Notify)))
+        if constexpr (canonical(Features).contains(Feature::Notify))
             return &ObjectType::template activateSignal<Value, Label>;
+        else
+            return nullptr;
+    }
+
+private:
+    /// Returns the extension of this object, or `nullptr` if it wasn't needed yet.
+    ///
+    [[nodiscard]] detail::ObjectExtension *findExtension() const noexcept
+    {
+        return m_extension.load(std::memory_order_acquire);
+    }
+
+    /// Returns the extension of this object, which gets allocated first if needed.
+    /// This can be called by any thread: If threads race, the first one installs
+    /// its extension, and the others release theirs.
+    ///
+    detail::ObjectExtension &extension()
+    {
+        if (const auto extension = findExtension())
+            return *extension;
+
+        auto created = std::make_unique<detail::ObjectExtension>();
+        auto installed = static_cast<detail::ObjectExtension *>(nullptr);
+
+        if (m_extension.compare_exchange_strong(installed, created.get(),
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
+            return *created.release();
+
+        return *installed;
+    }
 
-        return nullptr;
+    detail::PendingNotifications &pendingNotifications()
+    {
+        return extension().pendingNotifications;
     }
+
+    detail::DependencyGraph &dependencyGraph()
+    {
+        auto &graph = extension().dependencyGraph;
+
+        if (!graph.has_value()) {
+            const auto &metaObject = ObjectType::staticMetaObject;
+            graph.emplace(metaObject.computedRanking(), metaObject.computedPropertyCount(),
+                          metaObject.localPropertyCount());
+        }
+
+        return *graph;
+    }
+
+    void emitCoalescedNotifications()
+    {
+        // Receivers might change coalesced properties again. Therefore
+        // the pending notifications are taken before notifying anyone.
+        auto &pending = pendingNotifications();
+        pending.scheduled = false;
+        const auto coalesced = std::exchange(pending.coalesced, {});
+        ObjectType::staticMetaObject.emitNotifications(this, coalesced);
+    }
+
+    void applyPostedWrites()
+    {
+        const auto batch = batchNotifications();
+        extension().postedWrites.apply(this, ObjectType::staticMetaObject.localPropertyCount());
+    }
+
+    std::atomic<detail::ObjectExtension *> m_extension = nullptr;
 };
 
 /// Alias for a properties change notification signal.
@@ -8,6 +8,16 @@
 
 #include <QMetaObject>
 #include <QMetaType>
+#include <QVariant>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
 
 class QMetaObjectBuilder;
 
@@ -15,6 +25,19 @@ namespace nproperty::detail {
 
 using metaenum::KeyInfoArray;
 
+/// Returns the id of `T` if it's a builtin metatype, or `QMetaType::UnknownType`.
+/// Unlike `qMetaTypeId()` this is a constant expression for any type, as the ids
+/// of other types only are assigned at runtime, when they get registered.
+///
+template<typename T>
+consteval int builtinMetaTypeId() noexcept
+{
+    if constexpr (QMetaTypeId2<T>::IsBuiltIn)
+        return QMetaTypeId2<T>::MetaType;
+    else
+        return QMetaType::UnknownType;
+}
+
 /// Introspection information about class members.
 ///
 struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like...
@@ -31,27 +54,36 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
         ScopedFlag,
     };
 
+    using  OptionalOffset = std::optional<quintptr>;
     using  OffsetFunction =     quintptr(*)();
     using    ReadFunction =         void(*)(const QObject *, void *);
     using   WriteFunction =         void(*)(QObject *, void *);
     using   ResetFunction =         void(*)(QObject *);
+    using  NotifyFunction =         void(*)(QObject *);
+    using  ExpireFunction =       Expiry(*)(QObject *, Recomputation);
     using PointerFunction = const void *(*)();
     using    CastFunction =       void *(*)(QObject *);
     using KeyInfoFunction = KeyInfoArray(*)();
+    using MetaTypePointer = const QtPrivate::QMetaTypeInterface *;
 
     consteval MemberInfo() noexcept = default;
 
     template <class Object, typename Value, LabelId Label, FeatureSet Features>
     consteval MemberInfo(std::string_view        name,
                          OffsetFunction resolveOffset,
+                         OptionalOffset        offset,
                          const Property<Object, Value, Label, Features> * = nullptr) noexcept
         : type{Type::Property}
-        , valueType{qMetaTypeId<Value>()}
+        , valueType{builtinMetaTypeId<Value>()}
+        , metaType{QtPrivate::qMetaTypeInterfaceForType<Value>()}
         , features{Features}
         , label{Label}
+        , offset{offset}
         , name{name}
         , resolveOffset{resolveOffset}
         , readProperty{[](const QObject *object, void *result) {
+            // QMetaProperty::read() passes an already constructed value, therefore this
+            // assigns. As value() returns a reference, it's assigned straight from storage.
             const auto property = Property<Object, Value, Label, Features>::resolve(object);
             *reinterpret_cast<Value *>(result) = property->value();
         }}
@@ -67,6 +99,26 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
                 property->resetValue();
             }
         }}
+        , notifyProperty{[](QObject *object) {
+            if constexpr (canonical(Features).contains(Feature::Notify)) {
+                const auto property = Property<Object, Value, Label, Features>::resolve(object);
+                property->notify(property->value());
+            }
+        }}
+        , notifyChange{[](QObject *object) {
+            if constexpr (canonical(Features).contains(Feature::Notify)) {
+                const auto property = Property<Object, Value, Label, Features>::resolve(object);
+                property->notifyChange();
+            }
+        }}
+        , expireProperty{[](QObject *object, Recomputation recomputation) {
+            if constexpr (canonical(Features).contains(Feature::Computed)) {
+                const auto property = Property<Object, Value, Label, Features>::resolve(object);
+                return property->invalidate(recomputation);
+            } else {
+                return Expiry::Unchanged;
+            }
+        }}
         , pointer{[] {
             const auto proxy = Object::template signalProxy<Value, Label, Features>();
             return *reinterpret_cast<const void *const *>(&proxy);
@@ -157,7 +209,8 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
     constexpr bool isScoped() const noexcept { return isScoped(type); }
 
     template<auto Property>
-    static consteval MemberInfo makeProperty(std::string_view name) noexcept
+    static consteval MemberInfo makeProperty(std::string_view name,
+                                             OptionalOffset offset = {}) noexcept
     {
         using Object = typename DataMemberType<Property>::ObjectType;
 
@@ -167,7 +220,7 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
         };
 
         const auto selector = Prototype::null(Property);
-        return MemberInfo{std::move(name), resolveOffset, selector};
+        return MemberInfo{std::move(name), resolveOffset, offset, selector};
     }
 
     static consteval MemberInfo makeClassInfo(LabelId          label,
@@ -187,7 +240,7 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
     {
         auto interfaceInfo     = MemberInfo{};
         interfaceInfo.type     = Type::Interface;
-        interfaceInfo.name     = QMetaType::fromType<Interface>().name();
+        interfaceInfo.name     = QtPrivate::qMetaTypeInterfaceForType<Interface>()->name;
         interfaceInfo.value    = qobject_interface_iid<Interface *>();
         interfaceInfo.metacast = [](QObject *object) {
             const auto self = static_cast<Object *>(object);
@@ -201,11 +254,12 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
     requires(isEnumOrFlag(type))
     static constexpr MemberInfo makeEnumerator(LabelId label) noexcept
     {
-        auto enumeratorInfo  = MemberInfo{};
-        enumeratorInfo.type  = type;
-        enumeratorInfo.label = label;
-        enumeratorInfo.name  = metaenum::name<Enum>(); // QMetaType::fromType<Enum>() is not constexpr
-        enumeratorInfo.keys  = metaenum::keys<Enum, isFlag(type)>;
+        auto enumeratorInfo     = MemberInfo{};
+        enumeratorInfo.type     = type;
+        enumeratorInfo.label    = label;
+        enumeratorInfo.name     = metaenum::name<Enum>(); // QMetaType::fromType<Enum>() is not constexpr
+        enumeratorInfo.keys     = metaenum::keys<Enum, isFlag(type)>;
+        enumeratorInfo.metaType = QtPrivate::qMetaTypeInterfaceForType<Enum>();
 
         return enumeratorInfo;
     }
@@ -213,9 +267,11 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
     constexpr explicit operator bool() const noexcept { return type != Type::Invalid; }
 
     Type             type           = Type::Invalid;
-    int              valueType      = QMetaType::UnknownType;
+    int              valueType      = QMetaType::UnknownType; // only for builtin types, see metaType
+    MetaTypePointer  metaType       = nullptr;
     FeatureSet       features       = {};
     LabelId          label          = 0;
+    OptionalOffset   offset;
     std::string_view name;
     std::string_view value;
 
@@ -223,11 +279,173 @@ struct MemberInfo // FIXME: actually this is ObjectInfo, MetaInfo, or the like..
     ReadFunction     readProperty   = nullptr;
     WriteFunction    writeProperty  = nullptr;
     ResetFunction    resetProperty  = nullptr;
+    NotifyFunction   notifyProperty = nullptr;
+    NotifyFunction   notifyChange   = nullptr;
+    ExpireFunction   expireProperty = nullptr;
     PointerFunction  pointer        = nullptr;
     CastFunction     metacast       = nullptr;
     KeyInfoFunction  keys           = nullptr;
 };
 
+class DependencyGraph;
+class NotificationThrottle;
+
+/// The throttling state of a property with the `Throttle` feature: No notification
+/// is emitted before `until`. If a change was held back meanwhile, `pending` is set.
+///
+struct ThrottleState
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point         until    = {};
+    std::chrono::milliseconds interval = {};
+    bool                      pending  = false;
+};
+
+/// Notifications that are not emitted yet, indexed by local signal index:
+/// Those held back by a `NotificationBatch`, those of properties with the
+/// `Coalesce` feature, which are waiting for the event loop, and those of
+/// properties with the `Throttle` feature, which are waiting for their interval.
+///
+struct PendingNotifications
+{
+    PendingNotifications() noexcept = default;
+    ~PendingNotifications();
+
+    PendingNotifications(const PendingNotifications &) = delete;
+    PendingNotifications &operator=(const PendingNotifications &) = delete;
+
+    int                              depth          = 0;
+    bool                             scheduled      = false;
+    std::vector<bool>                changed;
+    std::vector<bool>                coalesced;
+    std::vector<ThrottleState>       throttled;
+
+    // The throttle of the object's thread, and the time it will emit the
+    // next held back notification, while such notifications exist.
+    NotificationThrottle            *throttle       = nullptr;
+    ThrottleState::Clock::time_point throttledUntil = {};
+};
+
+/// The property writes posted to an object by other threads. Any thread can push
+/// without locking. The object's thread takes all writes at once. This is a stack,
+/// as only the latest write of each property gets applied, so the newest come first.
+///
+class PostedWrites
+{
+public:
+    PostedWrites() noexcept = default;
+    ~PostedWrites();
+
+    PostedWrites(const PostedWrites &) = delete;
+    PostedWrites &operator=(const PostedWrites &) = delete;
+
+    /// Adds `write`, and returns `true` if it's the first write since the
+    /// last call of `apply()`. The caller then must schedule that call.
+    ///
+    bool push(PostedWrite *write) noexcept;
+
+    /// Applies the latest write of each property to `object`, and releases all writes.
+    ///
+    void apply(QObject *object, std::size_t propertyCount);
+
+private:
+    std::atomic<PostedWrite *> m_head = nullptr;
+    std::vector<bool>          m_applied; // reused by each call of apply()
+};
+
+/// Where a `Snapshot` stores the value of each property, indexed by local property index,
+/// and how much storage it needs. See `MetaObject::snapshotLayout()`.
+///
+struct SnapshotLayout
+{
+    std::span<const std::size_t> offsets;
+    std::size_t                  size      = 0;
+    std::size_t                  alignment = 1;
+};
+
+/// The offsets of a `SnapshotLayout`, computed at compile time from the member table.
+///
+template<std::size_t Count>
+struct SnapshotOffsets
+{
+    std::array<std::size_t, Count> offsets   = {};
+    std::size_t                    size      = 0;
+    std::size_t                    alignment = 1;
+};
+
+/// The topological order of the computed properties of a class, shared by all its objects:
+/// Each computed property is ranked behind the computed properties it was seen reading, by
+/// any object of the class. This is the declaration order, until a computed property reads
+/// one declared behind it. Then the order is derived once for the class, not per object.
+/// Properties of cycles keep their declaration order.
+///
+/// Objects of any thread record their reads. New reads are rare, and recorded under a lock.
+/// Each of them changes the order at most once. Orders are immutable, and kept until the
+/// class is gone, so that other threads can finish using an order that got replaced.
+///
+class ComputedRanking
+{
+public:
+    struct Order
+    {
+        std::vector<std::size_t> computedIndices; // indexed by rank
+        std::vector<std::size_t> ranks;           // indexed by computed index
+    };
+
+    /// Forgets all reads among the `computedCount` computed properties of the class.
+    ///
+    void reset(std::size_t computedCount);
+
+    /// The current order, or `nullptr` while it still is the declaration order.
+    ///
+    [[nodiscard]] const Order *current() const noexcept
+    {
+        return m_current.load(std::memory_order_acquire);
+    }
+
+    /// The position of the computed property at `computedIndex` in `order`.
+    ///
+    [[nodiscard]] static std::size_t rank(const Order *order, std::size_t computedIndex) noexcept
+    {
+        return order ? order->ranks[computedIndex] : computedIndex;
+    }
+
+    /// Records that the computed property at `dependent` has read the one at `dependency`.
+    /// Reads that already are known only cost a relaxed load.
+    ///
+    void record(std::size_t dependent, std::size_t dependency);
+
+private:
+    using Word = std::uint64_t;
+
+    static constexpr std::size_t WordBits = std::numeric_limits<Word>::digits;
+
+    [[nodiscard]] std::atomic<Word> &edge(std::size_t dependent, std::size_t dependency) const noexcept
+    {
+        return m_edges[dependent * m_rowSize + dependency / WordBits];
+    }
+
+    [[nodiscard]] static Word bit(std::size_t dependency) noexcept
+    {
+        return Word{1} << (dependency % WordBits);
+    }
+
+    [[nodiscard]] bool hasEdge(std::size_t dependent, std::size_t dependency) const noexcept
+    {
+        return edge(dependent, dependency).load(std::memory_order_relaxed) & bit(dependency);
+    }
+
+    void updateOrder();
+
+    std::size_t                               m_count   = 0;
+    std::size_t                               m_rowSize = 0;
+    std::unique_ptr<std::atomic<Word>[]>      m_edges;
+    std::atomic<const Order *>                m_current = nullptr;
+    std::vector<std::unique_ptr<const Order>> m_orders;
+    std::mutex                                m_mutex;
+};
+
 /// Introspection information about a C++ class that can be used to build a `QMetaObject`.
 ///
 class MetaObjectData
@@ -236,11 +454,54 @@ public:
     [[nodiscard]] const auto &members() const noexcept { return m_members; }
     [[nodiscard]] quintptr memberOffset(LabelId label) const noexcept;
     [[nodiscard]] int metaMethodIndexForLabel(LabelId label) const noexcept;
+    [[nodiscard]] std::size_t signalCount() const noexcept { return m_signalOffsets.size(); }
+    [[nodiscard]] std::size_t localPropertyCount() const noexcept { return m_propertyOffsets.size(); }
+    [[nodiscard]] std::size_t computedPropertyCount() const noexcept { return m_computedProperties.size(); }
+    [[nodiscard]] ComputedRanking &computedRanking() const noexcept { return m_computedRanking; }
+
+    /// Emits the notification signal of each property marked in `changed`,
+    /// in declaration order, and with the property's current value.
+    ///
+    void emitNotifications(QObject *object, const std::vector<bool> &changed) const;
+
+    /// Copies the value of each property of `object` into `storage`, at the offsets of `layout`.
+    ///
+    void copyProperties(const QObject *object, const SnapshotLayout &layout, std::byte *storage) const;
+
+    /// Destroys the values that `copyProperties()` has copied into `storage`.
+    ///
+    void destroyProperties(const SnapshotLayout &layout, std::byte *storage) const noexcept;
+
+    /// Updates the computed properties of `object` after the property at `propertyIndex`
+    /// was changed: Those that have read it are marked dirty. Then the dirty properties
+    /// are visited in topological order. Each of them is invalidated, or computed again
+    /// if it has receivers. Only if it might have changed, its dependents are marked
+    /// dirty too. This way each affected property is visited once, and reads only
+    /// properties that already are up-to-date.
+    ///
+    /// If the evaluation of `graph` is deferred, only the direct dependents are marked,
+    /// and `updateDependents()` is left to `ParallelEvaluation`.
+    ///
+    void invalidateDependents(QObject *object, DependencyGraph &graph,
+                              std::size_t propertyIndex) const;
+
+    /// Updates the computed properties of `object` marked dirty in `graph`, in topological
+    /// order. See `invalidateDependents()`. This doesn't touch other objects, and therefore
+    /// can be called by any thread, as long as nobody else uses `object` meanwhile. If the
+    /// evaluation of `graph` is deferred, all dirty properties are computed, also those
+    /// without receivers, so that the threads of `ParallelEvaluation` do the actual work.
+    ///
+    void updateDependents(QObject *object, DependencyGraph &graph) const;
+
+    /// Notifies the computed properties of `object` that have changed by
+    /// `invalidateDependents()`, in topological order: Receivers of a property
+    /// are notified after those of the properties it was computed from.
+    ///
+    void notifyDependents(QObject *object, DependencyGraph &graph) const;
 
 protected:
     void emplace(MemberInfo &&member);
     void metaCall(QObject *object, QMetaObject::Call call, int offset, void **args) const;
-    void *interfaceCast(QObject *object, std::string_view name) const;
 
     template<class Object, quintptr N>
     static consteval bool hasMember()
@@ -249,16 +510,24 @@ protected:
     }
 
     void validateMembers() const;
+    void buildLookupTables();
 
 private:
     using MemberTable  = std::vector<MemberInfo>;
     using MemberOffset = MemberTable::size_type;
 
+    /// A slot of the open addressing hash table that maps the signal pointers
+    /// received with `QMetaObject::IndexOfMethod` to their method index.
+    ///
+    struct SignalSlot
+    {
+        const void *pointer = nullptr;
+        int         index   = -1;
+    };
+
     [[nodiscard]] const MemberInfo *propertyInfo(MemberOffset offset) const noexcept;
     [[nodiscard]] const MemberInfo *memberInfo  (MemberOffset offset) const noexcept;
 
-    [[nodiscard]] std::function<const MemberInfo *(quintptr)> makeOffsetToInterface() const noexcept;
-    [[nodiscard]] std::function<const MemberInfo *(quintptr)> makeOffsetToSignal() const noexcept;
     [[nodiscard]] int metaMethodForPointer(const void *pointer) const noexcept;
 
     void readProperty(const QObject *object, MemberOffset offset, void *result) const;
@@ -269,9 +538,20 @@ private:
 private:
     MemberTable m_members;
 
-    std::vector<MemberOffset> m_interfaceOffsets;
     std::vector<MemberOffset> m_propertyOffsets;
     std::vector<MemberOffset> m_signalOffsets;
+
+    // The local property indices of all computed properties.
+    std::vector<std::size_t>  m_computedProperties;
+
+    // Lookup tables, derived from the members above by buildLookupTables().
+    // The labels are indexed like m_signalOffsets. The size of the signal
+    // table, which serves metaMethodForPointer(), is a power of two.
+    std::vector<LabelId>    m_signalLabels;
+    std::vector<SignalSlot> m_signalTable;
+
+    // Shared by the dependency graphs of all objects, which update it from any thread.
+    mutable ComputedRanking m_computedRanking;
 };
 
 /// Builds a QMetaObject from our static introspection information.
@@ -292,6 +572,25 @@ private:
     static void makeEnumerator(QMetaObjectBuilder &metaObject, const MemberInfo &enumeratorInfo);
 };
 
+/// Reports if emitting the signal at `signalIndex`, relative to `metaObject`, would
+/// have any effect. This is the very same check `QMetaObject::activate()` does first,
+/// but it can be done before preparing the signal's arguments.
+///
+[[nodiscard]] bool isSignalConnected(const QObject     *sender,
+                                     const QMetaObject *metaObject,
+                                     int               signalIndex) noexcept;
+
+/// Notifies immediately by returning `false`, if the interval of the property at
+/// `signalIndex` has passed, and starts a new interval. Otherwise the notification
+/// is held back, and emitted by the thread's `NotificationThrottle` once the current
+/// interval has passed.
+///
+[[nodiscard]] bool throttleNotification(QObject                   *object,
+                                        const MetaObjectData      *metaObject,
+                                        PendingNotifications      &pending,
+                                        int                       signalIndex,
+                                        std::chrono::milliseconds interval);
+
 } // namespace nproperty::detail
 
 namespace nproperty {
@@ -0,0 +1,474 @@
+#ifndef NPROPERTY_NMETAOBJECTGENERATOR_P_H
+#define NPROPERTY_NMETAOBJECTGENERATOR_P_H
+
+#include "nmetaobject_p.h"
+
+#include <private/qmetaobject_p.h>
+
+namespace nproperty::detail {
+
+/// Flags used in the data of metaobjects. This are the very same values as used by moc.
+/// They must not change within a major Qt release, as this would break compatibility
+/// with previously generated moc output.
+///
+namespace mocflags {
+
+constexpr uint Readable             = 0x00000001;
+constexpr uint Writable             = 0x00000002;
+constexpr uint Resettable           = 0x00000004;
+constexpr uint EnumOrFlag           = 0x00000008;
+constexpr uint StdCppSet            = 0x00000100;
+constexpr uint Constant             = 0x00000400;
+constexpr uint Final                = 0x00000800;
+constexpr uint Designable           = 0x00001000;
+constexpr uint Scriptable           = 0x00004000;
+constexpr uint Stored               = 0x00010000;
+
+constexpr uint AccessPublic         = 0x02;
+constexpr uint MethodSignal         = 0x04;
+
+constexpr uint EnumIsFlag           = 0x01;
+constexpr uint EnumIsScoped         = 0x02;
+
+constexpr uint IsUnresolvedType     = 0x80000000;
+constexpr uint NoNotifySignal       = static_cast<uint>(-1);
+
+} // namespace mocflags
+
+/// The string table of a metaobject, in the format used by moc: First there
+/// are offset and size of each string, relative to the start of this structure.
+/// Then the zero-terminated strings follow.
+///
+template<std::size_t StringCount, std::size_t CharCount>
+struct MetaObjectStringData
+{
+    uint offsetsAndSizes[StringCount * 2];
+    char stringdata0[CharCount];
+};
+
+/// Generates the data of a `QMetaObject` at compile time, in the very same format
+/// as moc does. Unlike metaobjects created by `MetaObjectBuilder` this data lives in
+/// read-only storage, and doesn't need any allocations or copies at startup.
+///
+/// Template arguments:
+/// * `ObjectType` - the type of the object to describe
+/// * `Source`     - a class providing a compile-time member table via `memberTable()`
+///
+template<class ObjectType, class Source>
+class MetaObjectGenerator
+{
+public:
+    /// The format of metaobjects changes with Qt releases. Only known revisions
+    /// are supported, for all others `MetaObjectBuilder` must be used.
+    ///
+    static constexpr int Revision = QMetaObjectPrivate::OutputRevision;
+    static constexpr bool isSupported() noexcept { return Revision >= 10 && Revision <= 12; }
+
+    [[nodiscard]] static constexpr const uint *stringData() noexcept
+    { return s_stringData.offsetsAndSizes; }
+
+    [[nodiscard]] static constexpr const uint *data() noexcept
+    { return s_data.data(); }
+
+    [[nodiscard]] static constexpr const QtPrivate::QMetaTypeInterface *const *metaTypes() noexcept
+    { return s_metaTypes.data(); }
+
+private:
+    /// Strings are stored in two parts, so that signal names can be generated
+    /// from property names without allocating memory at compile time.
+    ///
+    struct String
+    {
+        std::string_view text;
+        std::string_view suffix = {};
+
+        constexpr std::size_t size() const noexcept { return text.size() + suffix.size(); }
+        constexpr bool operator==(const String &) const noexcept = default;
+    };
+
+    static constexpr std::size_t HeaderSize          = 14;
+    static constexpr std::size_t IntsPerClassInfo    = 2;
+    static constexpr std::size_t IntsPerMethod       = 6;
+    static constexpr std::size_t IntsPerParameters   = 3; // return type, one argument, its name
+    static constexpr std::size_t IntsPerProperty     = 5;
+    static constexpr std::size_t IntsPerEnumerator   = 5;
+    static constexpr std::size_t IntsPerKey          = 2;
+
+    static constexpr bool isClassInfo(const MemberInfo &member) noexcept
+    {
+        return member.type == MemberInfo::Type::ClassInfo;
+    }
+
+    static constexpr bool isProperty(const MemberInfo &member) noexcept
+    {
+        return member.type == MemberInfo::Type::Property;
+    }
+
+    static constexpr bool isSignal(const MemberInfo &member) noexcept
+    {
+        return isProperty(member) && canonical(member.features).contains(Feature::Notify);
+    }
+
+    static constexpr bool isEnumerator(const MemberInfo &member) noexcept
+    {
+        return MemberInfo::isEnumOrFlag(member.type);
+    }
+
+    static constexpr bool isBuiltinType(const MemberInfo &member) noexcept
+    {
+        return member.valueType > QMetaType::UnknownType
+               && member.valueType < QMetaType::User;
+    }
+
+    static consteval String className() noexcept
+    {
+        return {QtPrivate::qMetaTypeInterfaceForType<ObjectType>()->name};
+    }
+
+    static consteval String typeName(const MemberInfo &member) noexcept
+    {
+        return {member.metaType->name};
+    }
+
+    /// Counts and positions of the various sections in the metaobject data.
+    ///
+    struct Layout
+    {
+        std::size_t classInfoCount  = 0;
+        std::size_t signalCount     = 0;
+        std::size_t propertyCount   = 0;
+        std::size_t enumeratorCount = 0;
+        std::size_t keyCount        = 0;
+
+        constexpr std::size_t classInfoIndex() const noexcept  { return HeaderSize; }
+        constexpr std::size_t methodIndex() const noexcept     { return classInfoIndex() + classInfoCount * IntsPerClassInfo; }
+        constexpr std::size_t parameterIndex() const noexcept  { return methodIndex() + signalCount * IntsPerMethod; }
+        constexpr std::size_t propertyIndex() const noexcept   { return parameterIndex() + signalCount * IntsPerParameters; }
+        constexpr std::size_t enumeratorIndex() const noexcept { return propertyIndex() + propertyCount * IntsPerProperty; }
+        constexpr std::size_t keyIndex() const noexcept        { return enumeratorIndex() + enumeratorCount * IntsPerEnumerator; }
+        constexpr std::size_t dataSize() const noexcept        { return keyIndex() + keyCount * IntsPerKey + 1; }
+
+        constexpr std::size_t enumeratorTypeCount() const noexcept
+        { return Revision >= 12 ? enumeratorCount : 0; }
+
+        constexpr std::size_t methodTypeIndex() const noexcept
+        { return propertyCount + enumeratorTypeCount() + 1; }
+
+        constexpr std::size_t metaTypeCount() const noexcept
+        { return methodTypeIndex() + signalCount * 2; }
+
+        constexpr std::size_t maximumStringCount() const noexcept
+        {
+            return 2                                    // class name, empty tag
+                   + classInfoCount * 2                 // name, value
+                   + propertyCount * 3                  // name, signal name, type name
+                   + enumeratorCount + keyCount;        // names
+        }
+    };
+
+    static consteval Layout makeLayout() noexcept
+    {
+        auto layout = Layout{};
+
+        for (const auto &member: Source::memberTable()) {
+            if (isClassInfo(member))
+                ++layout.classInfoCount;
+
+            if (isProperty(member))
+                ++layout.propertyCount;
+            if (isSignal(member))
+                ++layout.signalCount;
+
+            if (isEnumerator(member)) {
+                ++layout.enumeratorCount;
+                layout.keyCount += member.keys().size();
+            }
+        }
+
+        return layout;
+    }
+
+    static constexpr Layout s_layout = makeLayout();
+
+    /// The strings of this metaobject. Unlike moc this generator doesn't merge
+    /// duplicates, as searching for them gets too expensive at compile time for
+    /// classes with many members. Instead the strings of each member are stored
+    /// next to each other, starting at the index found in `memberStrings`:
+    ///
+    /// * class info: name, value
+    /// * property: name, name of the notification signal, name of unresolved types
+    /// * enumerator: name, keys
+    ///
+    struct StringTable
+    {
+        static constexpr uint ClassName = 0;
+        static constexpr uint EmptyString = 1;
+
+        std::array<String, s_layout.maximumStringCount()> strings = {};
+        std::array<uint, Source::memberTable().size()> memberStrings = {};
+        std::size_t count = 0;
+
+        constexpr void add(const String &string) noexcept
+        {
+            strings[count++] = string;
+        }
+
+        constexpr std::size_t charCount() const noexcept
+        {
+            auto charCount = std::size_t{0};
+
+            for (auto i = 0U; i < count; ++i)
+                charCount += strings[i].size() + 1;
+
+            return charCount;
+        }
+    };
+
+    static consteval StringTable makeStringTable() noexcept
+    {
+        auto table = StringTable{};
+        const auto &members = Source::memberTable();
+
+        table.add(className());
+        table.add({});
+
+        for (auto i = 0U; i < members.size(); ++i) {
+            const auto &member = members[i];
+            table.memberStrings[i] = static_cast<uint>(table.count);
+
+            if (isClassInfo(member)) {
+                table.add({member.name});
+                table.add({member.value});
+            }
+
+            if (isProperty(member)) {
+                table.add({member.name});
+
+                if (isSignal(member))
+                    table.add({member.name, "Changed"});
+                if (!isBuiltinType(member))
+                    table.add(typeName(member));
+            }
+
+            if (isEnumerator(member)) {
+                table.add({member.name});
+
+                for (const auto &[key, value]: member.keys())
+                    table.add({key});
+            }
+        }
+
+        return table;
+    }
+
+    static constexpr StringTable s_strings = makeStringTable();
+
+    using StringData = MetaObjectStringData<s_strings.count, s_strings.charCount()>;
+
+    static consteval StringData makeStringData() noexcept
+    {
+        auto stringData = StringData{};
+        auto charOffset = std::size_t{0};
+
+        for (auto i = 0U; i < s_strings.count; ++i) {
+            const auto &string = s_strings.strings[i];
+
+            stringData.offsetsAndSizes[2 * i]     = static_cast<uint>(sizeof(stringData.offsetsAndSizes)
+                                                                       + charOffset);
+            stringData.offsetsAndSizes[2 * i + 1] = static_cast<uint>(string.size());
+
+            for (const auto ch: string.text)
+                stringData.stringdata0[charOffset++] = ch;
+            for (const auto ch: string.suffix)
+                stringData.stringdata0[charOffset++] = ch;
+
+            stringData.stringdata0[charOffset++] = '\0';
+        }
+
+        return stringData;
+    }
+
+    static consteval uint typeInfo(const MemberInfo &member, uint firstString) noexcept
+    {
+        if (isBuiltinType(member))
+            return static_cast<uint>(member.valueType);
+
+        const auto typeNameString = firstString + (isSignal(member) ? 2 : 1);
+        return mocflags::IsUnresolvedType | typeNameString;
+    }
+
+    static consteval uint propertyFlags(const MemberInfo &member) noexcept
+    {
+        const auto features = canonical(member.features);
+
+        // Same flags as set by MetaObjectBuilder::makeProperty()
+        auto flags = mocflags::Designable | mocflags::Scriptable
+                     | mocflags::Stored | mocflags::Final;
+
+        if (features & Feature::Read)
+            flags |= mocflags::Readable;
+        if (features & Feature::Write)
+            flags |= mocflags::Writable | mocflags::StdCppSet; // QTBUG-120378
+        if (features & Feature::Reset)
+            flags |= mocflags::Resettable;
+        if (!(features & Feature::Notify))
+            flags |= mocflags::Constant;
+        if (member.metaType->flags & QMetaType::IsEnumeration)
+            flags |= mocflags::EnumOrFlag;
+
+        return flags;
+    }
+
+    static consteval uint enumeratorFlags(const MemberInfo &member) noexcept
+    {
+        auto flags = uint{0};
+
+        if (member.isFlag())
+            flags |= mocflags::EnumIsFlag;
+        if (member.isScoped())
+            flags |= mocflags::EnumIsScoped;
+
+        return flags;
+    }
+
+    static consteval auto makeData() noexcept
+    {
+        constexpr auto &layout = s_layout;
+        constexpr auto &strings = s_strings;
+
+        auto data = std::array<uint, layout.dataSize()>{};
+        const auto &members = Source::memberTable();
+
+        const auto position = [](std::size_t count, std::size_t index) {
+            return static_cast<uint>(count > 0 ? index : 0);
+        };
+
+        data[0]  = static_cast<uint>(Revision);
+        data[1]  = StringTable::ClassName;
+        data[2]  = static_cast<uint>(layout.classInfoCount);
+        data[3]  = position(layout.classInfoCount, layout.classInfoIndex());
+        data[4]  = static_cast<uint>(layout.signalCount);
+        data[5]  = position(layout.signalCount, layout.methodIndex());
+        data[6]  = static_cast<uint>(layout.propertyCount);
+        data[7]  = position(layout.propertyCount, layout.propertyIndex());
+        data[8]  = static_cast<uint>(layout.enumeratorCount);
+        data[9]  = position(layout.enumeratorCount, layout.enumeratorIndex());
+        data[10] = 0; // constructor count
+        data[11] = 0; // constructor index
+        data[12] = PropertyAccessInStaticMetaCall;
+        data[13] = static_cast<uint>(layout.signalCount);
+
+        auto classInfo  = layout.classInfoIndex();
+        auto method     = layout.methodIndex();
+        auto parameters = layout.parameterIndex();
+        auto property   = layout.propertyIndex();
+        auto enumerator = layout.enumeratorIndex();
+        auto key        = layout.keyIndex();
+
+        auto signalIndex    = uint{0};
+        auto methodTypeIndex = layout.methodTypeIndex();
+
+        for (auto i = 0U; i < members.size(); ++i) {
+            const auto &member = members[i];
+            const auto firstString = strings.memberStrings[i];
+
+            if (isClassInfo(member)) {
+                data[classInfo++] = firstString;
+                data[classInfo++] = firstString + 1;
+            }
+
+            if (isSignal(member)) {
+                data[method++] = firstString + 1;
+                data[method++] = 1; // argument count
+                data[method++] = static_cast<uint>(parameters);
+                data[method++] = StringTable::EmptyString;
+                data[method++] = mocflags::AccessPublic | mocflags::MethodSignal;
+                data[method++] = static_cast<uint>(methodTypeIndex);
+
+                data[parameters++] = QMetaType::Void;
+                data[parameters++] = typeInfo(member, firstString);
+                data[parameters++] = firstString;
+
+                methodTypeIndex += 2;
+            }
+
+            if (isProperty(member)) {
+                data[property++] = firstString;
+                data[property++] = typeInfo(member, firstString);
+                data[property++] = propertyFlags(member);
+                data[property++] = isSignal(member) ? signalIndex++ : mocflags::NoNotifySignal;
+                data[property++] = 0; // revision
+            }
+
+            if (isEnumerator(member)) {
+                const auto keys = member.keys();
+
+                data[enumerator++] = firstString;
+                data[enumerator++] = firstString; // alias
+                data[enumerator++] = enumeratorFlags(member);
+                data[enumerator++] = static_cast<uint>(keys.size());
+                data[enumerator++] = static_cast<uint>(key);
+
+                for (auto k = 0U; k < keys.size(); ++k) {
+                    data[key++] = firstString + 1 + k;
+                    data[key++] = static_cast<uint>(keys[k].second);
+                }
+            }
+        }
+
+        data[key] = 0; // end of data
+
+        return data;
+    }
+
+    template<typename T, bool ForceComplete = true>
+    static constexpr auto metaTypeInterface() noexcept
+    {
+        using Type = QtPrivate::TypeAndForceComplete<T, std::bool_constant<ForceComplete>>;
+        return QtPrivate::qTryMetaTypeInterfaceForType<ObjectType, Type>();
+    }
+
+    /// The metatypes in the order used by moc: first the properties,
+    /// then the enumerators, then the object itself, and finally return
+    /// type and arguments of each method.
+    ///
+    static consteval auto makeMetaTypes() noexcept
+    {
+        auto metaTypes = std::array<const QtPrivate::QMetaTypeInterface *,
+                                    s_layout.metaTypeCount()>{};
+        auto index = std::size_t{0};
+
+        const auto &members = Source::memberTable();
+
+        for (const auto &member: members) {
+            if (isProperty(member))
+                metaTypes[index++] = member.metaType;
+        }
+
+        if constexpr (s_layout.enumeratorTypeCount() > 0) {
+            for (const auto &member: members) {
+                if (isEnumerator(member))
+                    metaTypes[index++] = member.metaType;
+            }
+        }
+
+        metaTypes[index++] = metaTypeInterface<ObjectType>();
+
+        for (const auto &member: members) {
+            if (isSignal(member)) {
+                metaTypes[index++] = metaTypeInterface<void, false>();
+                metaTypes[index++] = member.metaType;
+            }
+        }
+
+        return metaTypes;
+    }
+
+    static constexpr StringData s_stringData = makeStringData();
+    static constexpr auto s_data = makeData();
+    static constexpr auto s_metaTypes = makeMetaTypes();
+};
+
+} // namespace nproperty::detail
+
+#endif // NPROPERTY_NMETAOBJECTGENERATOR_P_H
@@ -1,5 +1,7 @@
 #include "nobjecttest.h"
 
+#include <QPoint>
+
 namespace npropertytest {
 
 class CheckAssertions : public HelloWorld
@@ -43,6 +45,161 @@ static_assert(!features<&NObjectMacro::constant> .contains(Reset));
 static_assert(!features<&NObjectMacro::notifying>.contains(Reset));
 static_assert(!features<&NObjectMacro::writable> .contains(Reset));
 
+// Check that signal and property indices are resolved at compile time, in declaration order.
+
+template <auto Property>
+constexpr auto signalIndex = nproperty::detail::DataMemberType<Property>::ObjectType::MetaObject
+                             ::template signalIndex<nproperty::detail::DataMemberType<Property>::label()>();
+
+static_assert(signalIndex<&HelloWorld::world>       == 0);
+
+static_assert(signalIndex<&NObjectMacro::notifying> == 0);
+static_assert(signalIndex<&NObjectMacro::writable>  == 1);
+
+static_assert(signalIndex<&NObjectModern::notifying> == 0);
+static_assert(signalIndex<&NObjectModern::writable>  == 1);
+
+static_assert(signalIndex<&NObjectLegacy::notifying> == 0);
+static_assert(signalIndex<&NObjectLegacy::writable>  == 1);
+
+template <auto Property>
+constexpr auto propertyIndex = nproperty::detail::DataMemberType<Property>::ObjectType::MetaObject
+                               ::template propertyIndex<nproperty::detail::DataMemberType<Property>::label()>();
+
+static_assert(propertyIndex<&HelloWorld::hello>      == 0);
+static_assert(propertyIndex<&HelloWorld::world>      == 1);
+
+static_assert(propertyIndex<&NObjectMacro::constant> == 0);
+static_assert(propertyIndex<&NObjectMacro::writable> == 2);
+
+// Check that snapshots store their values like the members of a struct.
+
+template <auto Property>
+constexpr auto snapshotOffset = nproperty::detail::DataMemberType<Property>::ObjectType::MetaObject
+                                ::template snapshotOffset<nproperty::detail::DataMemberType<Property>::label()>();
+
+static_assert(snapshotOffset<&HelloWorld::hello>      == 0);
+static_assert(snapshotOffset<&HelloWorld::world>      == sizeof(int));
+static_assert(HelloWorld::MetaObject::snapshotLayout().size      == 2 * sizeof(int));
+static_assert(HelloWorld::MetaObject::snapshotLayout().alignment == alignof(int));
+
+static_assert(snapshotOffset<&NObjectMacro::constant> == 0);
+static_assert(snapshotOffset<&NObjectMacro::writable> == 2 * sizeof(QString));
+
+// Check that property offsets are resolved at compile time, where the compiler supports it.
+
+#ifdef NPROPERTY_HAS_BUILTIN_OFFSETOF
+
+template <auto Property>
+constexpr auto staticOffset = nproperty::detail::DataMemberType<Property>::offset();
+
+static_assert(staticOffset<&HelloWorld::hello> > 0);
+static_assert(staticOffset<&HelloWorld::world> > staticOffset<&HelloWorld::hello>);
+
+static_assert(staticOffset<&NObjectModern::notifying> > staticOffset<&NObjectModern::constant>);
+static_assert(staticOffset<&NObjectModern::writable>  > staticOffset<&NObjectModern::notifying>);
+
+#endif // NPROPERTY_HAS_BUILTIN_OFFSETOF
+
+// Check that the metaobject data generated at compile time has the expected layout.
+
+template <class Object>
+constexpr auto generatedData = nproperty::detail::MetaObjectGenerator<Object, typename Object::MetaObject>::data();
+
+template <class Object>
+constexpr auto generatedProperty(int index, int field)
+{
+    return generatedData<Object>[generatedData<Object>[7] + static_cast<uint>(index * 5 + field)];
+}
+
+static_assert(generatedData<HelloWorld>[2]  == 0); // class infos
+static_assert(generatedData<HelloWorld>[4]  == 1); // methods
+static_assert(generatedData<HelloWorld>[6]  == 2); // properties
+static_assert(generatedData<HelloWorld>[8]  == 0); // enumerators
+static_assert(generatedData<HelloWorld>[13] == 1); // signals
+
+static_assert(generatedData<NObjectMacro>[2]  == 1);
+static_assert(generatedData<NObjectMacro>[4]  == 2);
+static_assert(generatedData<NObjectMacro>[6]  == 3);
+static_assert(generatedData<NObjectMacro>[8]  == 2);
+static_assert(generatedData<NObjectMacro>[13] == 2);
+
+static_assert(generatedProperty<NObjectModern>(0, 2) == 0x15c01); // constant: readable, constant
+static_assert(generatedProperty<NObjectModern>(1, 2) == 0x15801); // notifying: readable
+static_assert(generatedProperty<NObjectModern>(2, 2) == 0x15903); // writable: readable, writable
+
+static_assert(generatedProperty<NObjectLegacy>(0, 3) == static_cast<uint>(-1));
+static_assert(generatedProperty<NObjectLegacy>(1, 3) == 0);
+static_assert(generatedProperty<NObjectLegacy>(2, 3) == 1);
+
+// Check that the perfect hash table used by metaCast() finds all its keys, and nothing else.
+
+using PerfectHashTable = nproperty::detail::PerfectHashTable<int, 4>;
+
+constexpr auto perfectHashTable = PerfectHashTable{{{
+    {"npropertytest::NObjectMacro", 1},
+    {"experiment::InterfaceOne",    2},
+    {"experiment/InterfaceOne/1.0", 3},
+    {"experiment::InterfaceOne",    4},
+}}};
+
+static_assert(*perfectHashTable.find("npropertytest::NObjectMacro") == 1);
+static_assert(*perfectHashTable.find("experiment::InterfaceOne")    == 2);
+static_assert(*perfectHashTable.find("experiment/InterfaceOne/1.0") == 3);
+static_assert( perfectHashTable.find("experiment::InterfaceTwo")    == nullptr);
+static_assert( perfectHashTable.find("")                            == nullptr);
+
+static_assert(NObjectMacro::MetaObject::castEntries().size() == 6);
+static_assert(HelloWorld::MetaObject::castEntries().size()   == 2);
+
+// Check that the change detection policies are applied.
+
+using nproperty::detail::isChanged;
+
+static_assert(!isChanged<Read>(1, 1));
+static_assert( isChanged<Read>(1, 2));
+static_assert( isChanged<Read | AlwaysNotify>(1, 1));
+static_assert(!isChanged<Read | CompareIdentity>(1, 1));
+static_assert(!isChanged<Read | CompareFuzzy>(1.0, 1.0 + 1e-14));
+static_assert( isChanged<Read | CompareFuzzy>(1.0, 1.1));
+static_assert(!isChanged<Read | CompareFuzzy>(0.0, 1e-14));
+static_assert( isChanged<Read | CompareFuzzy>(0.0, 0.1));
+
+// Check that the throttling interval is encoded within the feature set.
+
+using nproperty::throttled;
+using nproperty::throttleInterval;
+
+static_assert( canonical(Write | throttled(std::chrono::milliseconds{250})).contains(Notify));
+static_assert( canonical(Write | throttled(std::chrono::milliseconds{250})).contains(Throttle));
+static_assert(!canonical(Write).contains(Throttle));
+static_assert( canonical(Computed).contains(Notify));
+static_assert(throttleInterval(Write | throttled(std::chrono::milliseconds{250})) == std::chrono::milliseconds{250});
+static_assert(throttleInterval(throttled(std::chrono::milliseconds{32767}))        == std::chrono::milliseconds{32767});
+static_assert(throttleInterval(Write)                                              == std::chrono::milliseconds{0});
+
+// Check which types can be stored by atomic properties.
+
+using nproperty::detail::AtomicStorableType;
+
+static_assert( AtomicStorableType<int>);
+static_assert( AtomicStorableType<double>);
+static_assert( AtomicStorableType<QPoint>);
+static_assert(!AtomicStorableType<QString>);
+static_assert(!AtomicStorableType<std::array<qint64, 3>>);
+
+// Check that type ids are known at compile time for builtin types only.
+
+using nproperty::detail::builtinMetaTypeId;
+
+static_assert(builtinMetaTypeId<int>()         == QMetaType::Int);
+static_assert(builtinMetaTypeId<QByteArray>()  == QMetaType::QByteArray);
+static_assert(builtinMetaTypeId<std::string>() == QMetaType::UnknownType);
+
+// Check that the state of optional features costs objects a single pointer.
+
+static_assert(sizeof(nproperty::Object<HelloWorld>) == sizeof(QObject) + sizeof(void *));
+
 // Check that setValue() and operator= are protected for readonly properties
 
 template<auto (HelloWorld::*property)>
@@ -61,4 +218,12 @@ static_assert( AssignmentPermitted<&HelloWorld::world>);
 static_assert(!SetValuePermitted<&HelloWorld::hello>);
 static_assert( SetValuePermitted<&HelloWorld::world>);
 
+template<auto (HelloWorld::*property)>
+concept ModifyPermitted = requires (HelloWorld *object) {
+    (object->*property).modify([](int &value) { ++value; });
+};
+
+static_assert(!ModifyPermitted<&HelloWorld::hello>);
+static_assert( ModifyPermitted<&HelloWorld::world>);
+
 } // namespace npropertytest
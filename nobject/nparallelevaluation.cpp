@@ -0,0 +1,87 @@
+#include "nparallelevaluation.h"
+
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <latch>
+
+namespace nproperty {
+
+namespace {
+
+/// The state shared by the threads of one `ParallelEvaluation::run()`. Pool threads that
+/// start late only find that all tasks are taken. Therefore they keep it alive, while
+/// `run()` only waits until each task is done.
+///
+template<class Task>
+struct EvaluationState
+{
+    explicit EvaluationState(std::vector<Task> &&takenTasks)
+        : tasks{std::move(takenTasks)}
+        , pending{static_cast<std::ptrdiff_t>(tasks.size())}
+    {}
+
+    void evaluate()
+    {
+        for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < tasks.size();
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            const auto &task = tasks[i];
+            task.metaObject->updateDependents(task.object, *task.graph);
+            pending.count_down();
+        }
+    }
+
+    const std::vector<Task>  tasks;
+    std::atomic<std::size_t> next = 0;
+    std::latch               pending;
+};
+
+} // namespace
+
+ParallelEvaluation::ParallelEvaluation()
+    : ParallelEvaluation{QThreadPool::globalInstance()}
+{}
+
+ParallelEvaluation::ParallelEvaluation(QThreadPool *pool) noexcept
+    : m_pool{pool}
+{}
+
+ParallelEvaluation::~ParallelEvaluation()
+{
+    run();
+}
+
+void ParallelEvaluation::run()
+{
+    if (m_tasks.empty())
+        return;
+
+    const auto state = std::make_shared<EvaluationState<Task>>(std::exchange(m_tasks, {}));
+    const auto threadCount = std::min(static_cast<std::size_t>(std::max(m_pool->maxThreadCount(), 1)),
+                                      state->tasks.size());
+
+    // The calling thread is one of the threads, so that a pool
+    // with a single thread doesn't cause any context switch.
+    for (auto i = threadCount; i > 1; --i)
+        m_pool->start([state] { state->evaluate(); });
+
+    state->evaluate();
+    state->pending.wait();
+
+    const auto currentThread = QThread::currentThread();
+
+    for (const auto &task: state->tasks) {
+        task.graph->setDeferred(false);
+
+        if (task.object->thread() == currentThread) {
+            task.metaObject->notifyDependents(task.object, *task.graph);
+        } else {
+            QMetaObject::invokeMethod(task.object, [task] {
+                task.metaObject->notifyDependents(task.object, *task.graph);
+            }, Qt::QueuedConnection);
+        }
+    }
+}
+
+} // namespace nproperty
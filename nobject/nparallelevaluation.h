@@ -0,0 +1,81 @@
+#ifndef NPROPERTY_NPARALLELEVALUATION_H
+#define NPROPERTY_NPARALLELEVALUATION_H
+
+#include "nmetaobject.h"
+
+#include <vector>
+
+class QThreadPool;
+
+namespace nproperty {
+
+/// Updates the computed properties of many objects on the threads of a `QThreadPool`,
+/// after their inputs have changed. Computed properties only read properties of their
+/// own object. Therefore the dirty properties of each object form a subgraph, that is
+/// independent of the other objects, and objects can be updated in parallel. Idle
+/// threads pick the next object to update, so that expensive objects don't hold back
+/// the others. The notifications are emitted afterwards, by the thread of each object.
+///
+/// ``` C++
+/// auto evaluation = ParallelEvaluation{};
+///
+/// for (const auto series: allSeries) {
+///     evaluation.add(series);
+///     series->samples = newSamples;
+/// }
+///
+/// evaluation.run();
+/// ```
+///
+/// Until `run()` is called, the computed properties of added objects keep their
+/// previous values, and nobody else must use these objects while `run()` updates
+/// them. The objects must outlive the evaluation.
+///
+class ParallelEvaluation
+{
+public:
+    ParallelEvaluation();
+    explicit ParallelEvaluation(QThreadPool *pool) noexcept;
+    ~ParallelEvaluation();
+
+    ParallelEvaluation(const ParallelEvaluation &) = delete;
+    ParallelEvaluation &operator=(const ParallelEvaluation &) = delete;
+
+    /// Defers the update of the computed properties of `object` after changes until `run()`.
+    ///
+    template<class ObjectType>
+    void add(ObjectType *object)
+    {
+        static_assert(ObjectType::MetaObject::hasComputedProperties(),
+                      "Only objects with computed properties can be evaluated");
+
+        auto &graph = object->dependencyGraph();
+
+        if (!graph.isDeferred()) {
+            graph.setDeferred(true);
+            m_tasks.push_back({object, &ObjectType::staticMetaObject, &graph});
+        }
+    }
+
+    /// Updates the computed properties of all added objects, and waits until this is
+    /// done. The calling thread takes part in this. Then each changed computed property
+    /// is notified, immediately for objects of this thread, and by a queued call for
+    /// objects of other threads.
+    ///
+    void run();
+
+private:
+    struct Task
+    {
+        QObject                      *object;
+        const detail::MetaObjectData *metaObject;
+        detail::DependencyGraph      *graph;
+    };
+
+    QThreadPool      *m_pool;
+    std::vector<Task> m_tasks;
+};
+
+} // namespace nproperty
+
+#endif // NPROPERTY_NPARALLELEVALUATION_H
@@ -0,0 +1,120 @@
+#ifndef NPROPERTY_NPERFECTHASH_P_H
+#define NPROPERTY_NPERFECTHASH_P_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+namespace nproperty::detail {
+
+/// The hash of a string, and its length. Zero-terminated strings
+/// are scanned only once this way, also when comparing them later.
+///
+struct StringHash
+{
+    std::uint64_t hash;
+    std::size_t   size;
+};
+
+/// A seeded variant of the FNV-1a hash that can be used at compile time.
+///
+constexpr StringHash hashString(const char *str, std::uint64_t seed) noexcept
+{
+    auto hash = std::uint64_t{0xcbf29ce484222325} ^ seed;
+    auto size = std::size_t{0};
+
+    for (; str[size] != '\0'; ++size) {
+        hash ^= static_cast<unsigned char>(str[size]);
+        hash *= std::uint64_t{0x100000001b3};
+    }
+
+    return {hash, size};
+}
+
+constexpr StringHash hashString(std::string_view str, std::uint64_t seed) noexcept
+{
+    auto hash = std::uint64_t{0xcbf29ce484222325} ^ seed;
+
+    for (const auto ch: str) {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= std::uint64_t{0x100000001b3};
+    }
+
+    return {hash, str.size()};
+}
+
+template<typename Value>
+struct PerfectHashEntry
+{
+    std::string_view key   = {};
+    Value            value = {};
+};
+
+/// A hash table with string keys that is built at compile time. The seed of the
+/// hash function is chosen so that all keys get a slot of their own. Therefore
+/// each lookup needs one hash and at most one string comparison. Duplicate keys
+/// are ignored; the first entry of a key wins.
+///
+/// This is meant for the small key sets of class names and interfaces. The
+/// table is kept at least half empty to quickly find a suitable seed.
+///
+template<typename Value, std::size_t Count>
+class PerfectHashTable
+{
+public:
+    using Entry = PerfectHashEntry<Value>;
+
+    consteval explicit PerfectHashTable(const std::array<Entry, Count> &entries) noexcept
+    {
+        while (!tryInsert(entries))
+            ++m_seed;
+    }
+
+    [[nodiscard]] constexpr const Value *find(const char *key) const noexcept
+    {
+        const auto [hash, size] = hashString(key, m_seed);
+        const auto &entry = m_slots[static_cast<std::size_t>(hash & Mask)];
+
+        if (entry.key.size() == size && !entry.key.empty()
+            && entry.key == std::string_view{key, size})
+            return &entry.value;
+
+        return nullptr;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t seed() const noexcept { return m_seed; }
+
+private:
+    static constexpr std::size_t Capacity = std::bit_ceil(std::max<std::size_t>(2 * Count, 1));
+    static constexpr std::size_t Mask     = Capacity - 1;
+
+    consteval bool tryInsert(const std::array<Entry, Count> &entries) noexcept
+    {
+        std::ranges::fill(m_slots, Entry{});
+
+        for (const auto &entry: entries) {
+            if (entry.key.empty())
+                continue;
+
+            auto &slot = m_slots[static_cast<std::size_t>(hashString(entry.key, m_seed).hash & Mask)];
+
+            if (slot.key == entry.key)
+                continue;
+            if (!slot.key.empty())
+                return false;
+
+            slot = entry;
+        }
+
+        return true;
+    }
+
+    std::uint64_t                  m_seed  = 0;
+    std::array<Entry, Capacity>    m_slots = {};
+};
+
+} // namespace nproperty::detail
+
+#endif // NPROPERTY_NPERFECTHASH_P_H
@@ -7,4 +7,59 @@ static_assert(canonical(Feature::Notify) == (Feature::Read | Feature::Notify));
 static_assert(canonical(Feature::Reset)  == (Feature::Read | Feature::Notify | Feature::Reset));
 static_assert(canonical(Feature::Write)  == (Feature::Read | Feature::Notify | Feature::Write));
 
+PostedWritePool::Owner::Owner(std::size_t size, std::size_t alignment)
+    : pool{new PostedWritePool{size, alignment}}
+{}
+
+PostedWritePool::Owner::~Owner()
+{
+    pool->unref();
+}
+
+PostedWritePool::PostedWritePool(std::size_t size, std::size_t alignment) noexcept
+    : m_size{size}
+    , m_alignment{alignment}
+{}
+
+void *PostedWritePool::allocate()
+{
+    if (m_free == nullptr)
+        m_free = m_released.exchange(nullptr, std::memory_order_acquire);
+
+    void *storage = m_free;
+
+    if (storage != nullptr)
+        m_free = m_free->next;
+    else
+        storage = ::operator new(m_size, m_alignment);
+
+    m_references.fetch_add(1, std::memory_order_relaxed);
+    return storage;
+}
+
+void PostedWritePool::release(void *storage) noexcept
+{
+    const auto block = new (storage) Block{m_released.load(std::memory_order_relaxed)};
+
+    while (!m_released.compare_exchange_weak(block->next, block,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {}
+
+    unref();
+}
+
+void PostedWritePool::unref() noexcept
+{
+    if (m_references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    // Neither the thread, nor any node is left. Nobody else can touch the pool anymore.
+    for (auto list: {m_free, m_released.load(std::memory_order_acquire)}) {
+        while (list != nullptr)
+            ::operator delete(std::exchange(list, list->next), m_size, m_alignment);
+    }
+
+    delete this;
+}
+
 } // namespace nproperty::detail
@@ -5,8 +5,19 @@
 #include "nproperty_p.h"
 #include "ntypetraits.h"
 
+#include <QHashFunctions>
 #include <QObject>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+
 namespace nproperty {
 
 /// This macro is needed for each NObject to make it known to Qt's metatype system.
@@ -25,6 +36,8 @@ public:
 protected:                                                                      \
     template <quintptr N>                                                       \
     static consteval void member(::nproperty::detail::Tag<N>) {}                \
+    template <quintptr N>                                                       \
+    static void defaultValue(::nproperty::detail::Tag<N>) {}                    \
                                                                                 \
 private:                                                                        \
     static consteval quintptr lineOffset() { return __LINE__; }                 \
@@ -41,12 +54,31 @@ private:
 const ClassName::MetaObject ClassName::staticMetaObject = {};
 
 
+/// Compute the offset of a property within its object at compile time, if the
+/// compiler supports this for non-standard-layout classes like QObject.
+///
+#ifdef NPROPERTY_HAS_BUILTIN_OFFSETOF
+#define NPROPERTY_MEMBER_OFFSET(ClassName, MemberName) __builtin_offsetof(ClassName, MemberName)
+#else
+#define NPROPERTY_MEMBER_OFFSET(ClassName, MemberName) std::nullopt
+#endif
+
 /// Register a property for introspection.
 /// This is mainly for special cases. You might prefer N_PROPERTY().
 ///
+/// The trailing `static_assert()` consumes the semicolon that must follow this
+/// macro. Without it, that semicolon would become an empty declaration behind
+/// the pragmas, which is reported by `-Wpedantic`.
+///
 #define N_REGISTER_PROPERTY(PropertyName) \
+    QT_WARNING_PUSH \
+    QT_WARNING_DISABLE_GCC("-Winvalid-offsetof") \
+    QT_WARNING_DISABLE_CLANG("-Winvalid-offsetof") \
     static consteval auto member(::nproperty::detail::Tag<__LINE__>) \
-    { return makeProperty<&TargetType::PropertyName>(#PropertyName); }
+    { return makeProperty<&TargetType::PropertyName>(#PropertyName, \
+                                                     NPROPERTY_MEMBER_OFFSET(TargetType, PropertyName)); } \
+    QT_WARNING_POP \
+    static_assert(true)
 
 /// Define a class member for connecting to property notifications using
 /// traditional syntax: `connect(object, &Object::propertyChanged, ...);`
@@ -107,9 +139,22 @@ friend constexpr const char *qt_getEnumName(Name) noexcept { return #Name; } \
 /// FIXME: consider wording for `detail::LineNumber::current()`
 ///
 #define N_PROPERTY(Type, Name, ...) \
-    N_REGISTER_PROPERTY(Name) \
+    N_REGISTER_PROPERTY(Name); \
     Property<Type, __LINE__, ##__VA_ARGS__> Name
 
+/// Like `N_PROPERTY()`, but also declares the default value of the property, to which
+/// `resetValue()` returns, and which sparse properties don't store. The property gets
+/// initialized with it. The default is stored once per class, and doesn't depend on the
+/// values constructors initialize objects with. Put it in parentheses if it has commas.
+///
+/// ``` C++
+/// N_PROPERTY_WITH_DEFAULT(QString, title, u"untitled"_qs, Write | Reset);
+/// ```
+///
+#define N_PROPERTY_WITH_DEFAULT(Type, Name, DefaultValue, ...) \
+    static Type defaultValue(::nproperty::detail::Tag<__LINE__>) { return DefaultValue; } \
+    N_PROPERTY(Type, Name, ##__VA_ARGS__) = defaultValue(::nproperty::detail::Tag<__LINE__>{})
+
 
 /// Theses flags describe various capabilites of a property.
 ///
@@ -119,6 +164,31 @@ enum class Feature
     Reset   = (1 << 1),
     Notify  = (1 << 2),
     Write   = (1 << 3),
+
+    // By default changes are detected by `operator!=()`.
+    // At most one of these features selects a different policy.
+    CompareIdentity = (1 << 4), // compares the data pointers of implicitly shared types
+    CompareFuzzy    = (1 << 5), // uses `qFuzzyCompare()`, e.g. to ignore jitter of floats
+    CompareHash     = (1 << 6), // compares the results of `qHash()`
+    AlwaysNotify    = (1 << 7), // doesn't compare at all
+
+    // Emit at most one notification per event loop iteration, with the latest value.
+    Coalesce        = (1 << 8),
+
+    // Emit at most one notification per interval, see throttled().
+    Throttle        = (1 << 9),
+
+    // Store the value in a `std::atomic`, so that it can be read from any thread.
+    Atomic          = (1 << 10),
+
+    // Store the values of all objects in one contiguous column, see `detail::ColumnSlot`.
+    Columnar        = (1 << 11),
+
+    // Compute the value from other properties when read, see `detail::ComputedValue`.
+    Computed        = (1 << 12),
+
+    // Store the value per object only if it differs from the default, see `detail::SparseSlot`.
+    Sparse          = (1 << 13),
 };
 
 using FeatureSet = metaenum::Flags<Feature>;
@@ -126,6 +196,50 @@ using FeatureSet = metaenum::Flags<Feature>;
 constexpr FeatureSet operator|(Feature lhs, Feature rhs) noexcept
 { return FeatureSet{lhs} | rhs; }
 
+constexpr FeatureSet operator|(Feature lhs, FeatureSet rhs) noexcept
+{ return FeatureSet{static_cast<FeatureSet::ValueType>(FeatureSet{lhs}.value | rhs.value)}; }
+
+constexpr FeatureSet operator|(FeatureSet lhs, FeatureSet rhs) noexcept
+{ return FeatureSet{static_cast<FeatureSet::ValueType>(lhs.value | rhs.value)}; }
+
+namespace detail {
+
+constexpr int ThrottleIntervalShift = 16;
+constexpr int MaximumThrottleInterval = 0x7fff;
+
+// The throttle interval is stored in the bits above the features, see throttled().
+static_assert(std::ranges::all_of(metaenum::keys<Feature, true>(), [](const metaenum::KeyInfo &key) {
+                  return key.second < (1 << ThrottleIntervalShift);
+              }), "Features must not overlap the bits of the throttle interval");
+
+} // namespace detail
+
+/// Properties with this feature notify at most once per `interval`: The first
+/// change is notified immediately. Further changes within the interval are held
+/// back, and the latest value is notified when the interval has passed. The interval
+/// is stored in the upper bits of the feature set, and must not exceed 32767 ms.
+///
+/// ``` C++
+/// N_PROPERTY(double, temperature, Write | throttled(250ms));
+/// ```
+///
+consteval FeatureSet throttled(std::chrono::milliseconds interval)
+{
+    if (interval.count() < 1 || interval.count() > detail::MaximumThrottleInterval)
+        throw "The throttling interval must be between 1 and 32767 milliseconds";
+
+    const auto encodedInterval = static_cast<int>(interval.count()) << detail::ThrottleIntervalShift;
+    return FeatureSet{static_cast<FeatureSet::ValueType>(encodedInterval)} | Feature::Throttle;
+}
+
+/// Reports the throttling interval encoded by `throttled()` in `features`.
+///
+constexpr std::chrono::milliseconds throttleInterval(FeatureSet features) noexcept
+{
+    return std::chrono::milliseconds{(features.value >> detail::ThrottleIntervalShift)
+                                     & detail::MaximumThrottleInterval};
+}
+
 /// Some features only make sense, or only can be reasonably
 /// implemented in combination with other features. This function
 /// is used to add theses incomplete rules to a feature set.
@@ -136,12 +250,199 @@ static constexpr FeatureSet canonical(FeatureSet features)
         features |= Feature::Notify;
     if (features &  Feature::Reset)
         features |= Feature::Notify;
+    if (features &  Feature::Coalesce)
+        features |= Feature::Notify;
+    if (features &  Feature::Throttle)
+        features |= Feature::Notify;
+    if (features &  Feature::Computed)
+        features |= Feature::Notify;
     if (features &  Feature::Notify)
         features |= Feature::Read;
 
     return features;
 }
 
+namespace detail {
+
+template<typename T>
+concept ImplicitlySharedType = requires(const T &value) {
+    value.constData();
+    value.size();
+};
+
+template<typename T>
+concept FuzzyComparableType = requires(const T &lhs, const T &rhs) {
+    { qFuzzyCompare(lhs, rhs) } -> std::convertible_to<bool>;
+};
+
+template<typename T>
+concept HashableType = requires(const T &value) {
+    { qHash(value) } -> std::convertible_to<std::size_t>;
+};
+
+/// Types that can be stored by properties with the `Atomic` feature: Only those for which
+/// `std::atomic` is lock-free on the target platform. Wider types, like 16 bytes with GCC,
+/// would need libatomic, which implements them by calls that might take locks.
+///
+template<typename T>
+concept AtomicStorableType = std::is_trivially_copyable_v<T>
+                             && std::is_copy_constructible_v<T>
+                             && std::atomic<T>::is_always_lock_free;
+
+static constexpr int comparisonPolicyCount(FeatureSet features) noexcept
+{
+    return features.contains(Feature::CompareIdentity)
+           + features.contains(Feature::CompareFuzzy)
+           + features.contains(Feature::CompareHash)
+           + features.contains(Feature::AlwaysNotify);
+}
+
+/// Reports if `newValue` differs from `oldValue`, using the change detection
+/// policy selected by `Features`. The policy is resolved at compile time.
+///
+template<FeatureSet Features, typename Value>
+constexpr bool isChanged(const Value &oldValue, const Value &newValue)
+{
+    static_assert(comparisonPolicyCount(Features) <= 1,
+                  "Only one comparison policy can be selected for a property");
+
+    if constexpr (Features.contains(Feature::AlwaysNotify)) {
+        return true;
+    } else if constexpr (Features.contains(Feature::CompareIdentity)) {
+        static_assert(ImplicitlySharedType<Value> || std::is_scalar_v<Value>,
+                      "Comparing the identity of this type is not supported");
+
+        if constexpr (ImplicitlySharedType<Value>) {
+            return oldValue.constData() != newValue.constData()
+                   || oldValue.size() != newValue.size();
+        } else {
+            return oldValue != newValue;
+        }
+    } else if constexpr (Features.contains(Feature::CompareFuzzy)) {
+        static_assert(FuzzyComparableType<Value>, "qFuzzyCompare() is not supported for this type");
+
+        // qFuzzyCompare() cannot handle zero, see its documentation
+        if constexpr (std::is_floating_point_v<Value>) {
+            if (qFuzzyIsNull(oldValue) || qFuzzyIsNull(newValue))
+                return !(qFuzzyIsNull(oldValue) && qFuzzyIsNull(newValue));
+        }
+
+        return !qFuzzyCompare(oldValue, newValue);
+    } else if constexpr (Features.contains(Feature::CompareHash)) {
+        static_assert(HashableType<Value>, "qHash() is not supported for this type");
+        return qHash(oldValue) != qHash(newValue);
+    } else {
+        return oldValue != newValue;
+    }
+}
+
+/// The storage of properties with the `Columnar` feature: The values of all objects
+/// live in one contiguous column per property, and the property itself only holds
+/// the index of its value. The column is kept dense by moving the last value into
+/// the slot of a destroyed object. The column is not synchronized. Therefore all
+/// objects of a class using columnar properties must live in the same thread, which
+/// debug builds assert when objects are constructed or destroyed.
+///
+template<class Owner, typename Value>
+class ColumnSlot
+{
+    // std::vector<bool> stores bits, and provides neither `bool &` nor `std::span<const bool>`.
+    static_assert(!std::is_same_v<Value, bool>, "Columnar properties cannot be bool, use quint8 instead");
+
+public:
+    using Index = std::uint32_t;
+
+    ColumnSlot() : ColumnSlot{Value{}} {}
+    ColumnSlot(Value value)
+        : m_index{static_cast<Index>(s_column.values.size())}
+    {
+        assertColumnThread();
+
+        s_column.values.emplace_back(std::move(value));
+        s_column.owners.emplace_back(this);
+    }
+
+    ~ColumnSlot()
+    {
+        assertColumnThread();
+
+        const auto last = s_column.values.size() - 1;
+
+        if (m_index != last) {
+            s_column.values[m_index] = std::move(s_column.values[last]);
+            s_column.owners[m_index] = s_column.owners[last];
+            s_column.owners[m_index]->m_index = m_index;
+        }
+
+        s_column.values.pop_back();
+        s_column.owners.pop_back();
+    }
+
+    ColumnSlot(const ColumnSlot &) = delete;
+    ColumnSlot &operator=(const ColumnSlot &) = delete;
+
+    [[nodiscard]] Value &get() noexcept { return s_column.values[m_index]; }
+    [[nodiscard]] const Value &get() const noexcept { return s_column.values[m_index]; }
+
+    /// The values of all objects, in no particular order.
+    ///
+    [[nodiscard]] static std::span<const Value> values() noexcept { return s_column.values; }
+
+private:
+    struct Column
+    {
+        std::vector<Value>        values;
+        std::vector<ColumnSlot *> owners;
+        std::thread::id           thread;
+    };
+
+    /// The column belongs to the thread that constructed its first object.
+    ///
+    static void assertColumnThread() noexcept
+    {
+        if (s_column.values.empty())
+            s_column.thread = std::this_thread::get_id();
+
+        Q_ASSERT_X(s_column.thread == std::this_thread::get_id(), "ColumnSlot",
+                   "All objects with columnar properties must live in the same thread");
+    }
+
+    static inline Column s_column = {};
+
+    Index m_index;
+};
+
+/// The storage of properties with the `Computed` feature: The value returned by the
+/// property's function when it was called last. It remains valid until a property
+/// read by that function changes. The function is called by the first read after
+/// that, or immediately, if the computed property has receivers.
+///
+/// Changes are propagated in topological order, which initially is the declaration
+/// order. Computed properties may also read computed properties declared behind them,
+/// but then the order is derived from the reads recorded by all objects of the class,
+/// and the first propagation after that computes some properties twice. Changed
+/// properties are notified in the same order. Cycles are not supported: Their
+/// properties just get updated in declaration order.
+///
+template<class Object, typename Value>
+struct ComputedValue
+{
+    using Function = Value (*)(const Object &);
+
+    Function      function = nullptr;
+    mutable Value value    = {};
+    mutable bool  valid    = false;
+};
+
+/// The storage of properties with the `Sparse` feature, which is empty: The default value
+/// is stored once per class, like for resetable properties. Only values differing from it
+/// are stored by the object, in a flat map shared by all its sparse properties. This suits
+/// classes with many properties, of which most objects only change a few.
+///
+struct SparseSlot {};
+
+} // namespace detail
+
 /// A unique number identifying members within their object, usually just the line number.
 ///
 using LabelId = std::uintptr_t;
@@ -163,11 +464,41 @@ public:
 
     friend ObjectType;
 
-    Property() noexcept = default;
-    Property(ValueType value) noexcept
+    Property() noexcept requires(!canonical(Features).contains(Feature::Reset)
+                                 && !canonical(Features).contains(Feature::Sparse)) = default;
+    Property() noexcept requires(canonical(Features).contains(Feature::Reset)
+                                 && !canonical(Features).contains(Feature::Sparse))
+        : m_value{}
+    {}
+
+    Property(ValueType value) noexcept requires(!canonical(Features).contains(Feature::Sparse))
         : m_value{std::move(value)}
     {}
 
+    /// Sparse properties only store their initial value in the object,
+    /// if it differs from the default value of their class, see `defaultValue()`.
+    ///
+    Property() requires(canonical(Features).contains(Feature::Sparse))
+    { storeSparseValue(ValueType{}); }
+
+    Property(ValueType value) requires(canonical(Features).contains(Feature::Sparse))
+    { storeSparseValue(std::move(value)); }
+
+    /// Computed properties are initialized with the function computing their
+    /// value from other properties of the object. Captureless lambdas will do:
+    ///
+    /// ``` C++
+    /// N_PROPERTY(int, area, Computed) = [](const Rectangle &self) {
+    ///     return self.width() * self.height();
+    /// };
+    /// ```
+    ///
+    template<std::convertible_to<ValueType (*)(const ObjectType &)> Function>
+    requires(canonical(Features).contains(Feature::Computed))
+    Property(Function function) noexcept
+        : m_value{static_cast<ValueType (*)(const ObjectType &)>(function)}
+    {}
+
     [[nodiscard]] static constexpr TagType tag() noexcept               { return {}; }
     [[nodiscard]] static constexpr LabelId label() noexcept             { return Label; }
     [[nodiscard]] static constexpr std::string_view name() noexcept;
@@ -180,26 +511,108 @@ public:
     [[nodiscard]] static constexpr bool isNotifiable() noexcept         { return hasFeature(Feature::Notify); }
     [[nodiscard]] static constexpr bool isWritable() noexcept           { return hasFeature(Feature::Write); }
 
+    [[nodiscard]] static constexpr bool isAtomic() noexcept             { return hasFeature(Feature::Atomic); }
+    [[nodiscard]] static constexpr bool isColumnar() noexcept           { return hasFeature(Feature::Columnar); }
+    [[nodiscard]] static constexpr bool isComputed() noexcept           { return hasFeature(Feature::Computed); }
+    [[nodiscard]] static constexpr bool isSparse() noexcept             { return hasFeature(Feature::Sparse); }
+
+    /// Reports if computed properties of this class might read this property.
+    /// Changes of such properties must be reported to the object, even if
+    /// nobody is connected to their notification signal.
+    ///
+    [[nodiscard]] static constexpr bool hasDependents() noexcept
+    {
+        return ObjectType::MetaObject::hasComputedProperties();
+    }
+
+    static_assert(!isAtomic() || detail::AtomicStorableType<ValueType>,
+                  "Atomic properties require trivially copyable values that are lock-free atomics");
+    static_assert(!isAtomic() || !isColumnar(),
+                  "Properties cannot be atomic and columnar at the same time");
+    static_assert(!isComputed() || !(isWritable() || isAtomic() || isColumnar() || isResetable()),
+                  "Computed properties cannot be writable, atomic, columnar, or resetable");
+    static_assert(!isSparse() || !(isAtomic() || isColumnar() || isComputed()),
+                  "Sparse properties cannot be atomic, columnar, or computed");
+
     using PublicValue = std::conditional_t<isWritable(), ValueType, std::monostate>;
 
+    /// Just like `QProperty` values are read by const reference, unless they
+    /// are cheap to copy. This avoids copying large values for each read.
+    /// Atomic, columnar, and sparse properties always are read by value,
+    /// as their storage might change meanwhile.
+    ///
+    using ParameterType = std::conditional_t<std::is_arithmetic_v<ValueType>
+                                             || std::is_enum_v<ValueType>
+                                             || std::is_pointer_v<ValueType>
+                                             || isAtomic() || isColumnar() || isSparse(),
+                                             ValueType, const ValueType &>;
+
+    /// Reading computed properties might call their function, which might allocate or
+    /// throw. Reading properties with dependents records them, and isn't promised to be
+    /// nothrow either. Other properties are read without throwing, unless copying their
+    /// value throws.
+    ///
+    [[nodiscard]] static constexpr bool isNothrowReadable() noexcept
+    {
+        return !isComputed() && !hasDependents()
+                && (std::is_reference_v<ParameterType> || std::is_nothrow_copy_constructible_v<ValueType>);
+    }
+
+    /// Properties with the `Atomic` feature can be read from any thread without
+    /// locking. They still should be written by their object's thread, as changes
+    /// are notified from the writing thread.
+    ///
+    using AtomicStorage = std::conditional_t<isAtomic(), std::atomic<ValueType>, ValueType>;
+    using ColumnStorage = std::conditional_t<isColumnar(), detail::ColumnSlot<Property, ValueType>,
+                                                           AtomicStorage>;
+    using SparseStorage = std::conditional_t<isSparse(), detail::SparseSlot, ColumnStorage>;
+    using StorageType = std::conditional_t<isComputed(), detail::ComputedValue<ObjectType, ValueType>,
+                                                         SparseStorage>;
+
     /// verbose syntax
     ///
     void resetValue();
     void setValue(PublicValue newValue);
-    ValueType value() const { return m_value; }
+    ParameterType value() const noexcept(isNothrowReadable());
 
     /// Qt convenience syntax
     ///
-    ValueType operator()() const { return value(); }
+    ParameterType operator()() const noexcept(isNothrowReadable()) { return value(); }
 
     /// Python convenience syntax
     ///
     Property &operator=(PublicValue newValue) { setValue(std::move(newValue)); return *this; }
-    operator ValueType() const { return value(); }
+    operator ParameterType() const noexcept(isNothrowReadable()) { return value(); }
+
+    /// In-place modification, e.g. of containers: The `modifier` receives a mutable
+    /// reference to the value. Afterwards exactly one notification is emitted. The
+    /// value isn't copied, nor compared. Instead the modifier can return `false` to
+    /// report that it didn't change anything, which then suppresses the notification.
+    /// Atomic properties pass a copy, and might call the modifier more than once.
+    ///
+    template<std::invocable<ValueType &> Modifier>
+    requires(isWritable())
+    void modify(Modifier &&modifier) { modifyImpl(std::forward<Modifier>(modifier)); }
+
+    /// The values of this property for all objects of its class, in no particular
+    /// order. This allows scanning a property without touching the objects.
+    ///
+    [[nodiscard]] static std::span<const ValueType> column() noexcept requires(isColumnar())
+    {
+        return StorageType::values();
+    }
+
+    /// Writes from any thread: The value is queued without locking, and the object's
+    /// thread applies it with the other writes posted meanwhile, within one batch of
+    /// notifications. Only the latest value posted for this property gets applied.
+    /// The queued value is stored in a `PostedWritePool` of the posting thread.
+    ///
+    void post(ValueType newValue) requires(isWritable());
 
     /// Signal emission
     ///
     void notify(Value newValue);
+    [[nodiscard]] bool hasReceivers() const noexcept;
 
     template<std::derived_from<QObject> Receiver, typename Functor>
     QMetaObject::Connection connect(Receiver *context, Functor functor) const
@@ -213,6 +626,34 @@ protected:
     void setValue(ProtectedValue newValue);
     void setValueImpl(Value &&newValue);
 
+    template<std::invocable<ValueType &> Modifier>
+    requires(!isWritable())
+    void modify(Modifier &&modifier) { modifyImpl(std::forward<Modifier>(modifier)); }
+
+    template<std::invocable<ValueType &> Modifier>
+    void modifyImpl(Modifier &&modifier);
+
+    void notifyChange();
+
+    [[nodiscard]] bool isRecordingChanges() const noexcept { return object()->isRecordingChanges(); }
+    void markChanged() noexcept { object()->template markPropertyChanged<Label>(); }
+    void publishChange() { object()->publishUnbatchedChange(); }
+
+    void invalidateDependents() { object()->template invalidateDependents<Label>(); }
+    void notifyDependents() { object()->notifyDependents(); }
+    void recordDependency() const { object()->template recordDependency<Label>(); }
+
+    /// Computed properties call their function, and record the properties it reads.
+    ///
+    void compute() const requires(isComputed());
+
+    /// Called when a property read by the function of this computed property has changed.
+    /// The notification of a changed value is left to the caller, so that it can be emitted
+    /// after all computed properties affected by the change have been updated. See
+    /// `detail::Recomputation` for when the property is computed again.
+    ///
+    detail::Expiry invalidate(detail::Recomputation recomputation) requires(isComputed());
+
     Property &operator=(ProtectedValue newValue) { setValue(std::move(newValue)); return *this; }
 
 public:
@@ -226,7 +667,12 @@ public:
 
     [[nodiscard]] static constexpr quintptr offset() noexcept
     {
-        return ObjectType::staticMetaObject.memberOffset(label());
+        constexpr auto staticOffset = ObjectType::MetaObject::template staticMemberOffset<Label>();
+
+        if constexpr (staticOffset.has_value())
+            return *staticOffset;
+        else
+            return ObjectType::staticMetaObject.memberOffset(label());
     }
 
     [[nodiscard]] static constexpr const Property *resolve(const QObject *object) noexcept
@@ -255,9 +701,105 @@ public:
     }
 
 private:
-    ValueType m_value;
+    struct PostedValue : detail::PostedWrite
+    {
+        ValueType value;
+    };
+
+    static void consumePostedValue(QObject *object, detail::PostedWrite *write, bool apply);
+
+    friend detail::MemberInfo;
+
+    [[nodiscard]] ValueType &storedValue() noexcept requires(!isSparse());
+    [[nodiscard]] const ValueType &storedValue() const noexcept;
+
+    /// The default value of resetable and sparse properties is stored once per class,
+    /// instead of once per object. It is declared together with the property, usually
+    /// by `N_PROPERTY_WITH_DEFAULT()`, and therefore doesn't depend on the objects:
+    /// Their constructors might initialize the property with any other value.
+    /// Without such declaration the default is a value-initialized `ValueType`.
+    ///
+    static const ValueType &defaultValue() requires(isResetable() || isSparse());
+
+    /// The object stores the values of sparse properties that differ from the default.
+    /// This stores `value`, or releases the stored value if `value` is the default.
+    /// Writes compare with the current value first, so that writing the value already
+    /// read, like writing the default to a property that has it, doesn't touch the map.
+    ///
+    void storeSparseValue(ValueType &&value) requires(isSparse());
+
+    StorageType m_value;
 };
 
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline auto Property<Object, Value, Label, Features>::value() const noexcept(isNothrowReadable()) -> ParameterType
+{
+    if constexpr (hasDependents())
+        recordDependency();
+
+    if constexpr (isComputed()) {
+        if (!m_value.valid)
+            compute();
+    }
+
+    if constexpr (isAtomic())
+        return m_value.load(std::memory_order_acquire);
+    else
+        return storedValue();
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline Value &Property<Object, Value, Label, Features>::storedValue() noexcept requires(!isSparse())
+{
+    if constexpr (isColumnar())
+        return m_value.get();
+    else if constexpr (isComputed())
+        return m_value.value;
+    else
+        return m_value;
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline const Value &Property<Object, Value, Label, Features>::storedValue() const noexcept
+{
+    if constexpr (isColumnar()) {
+        return m_value.get();
+    } else if constexpr (isComputed()) {
+        return m_value.value;
+    } else if constexpr (isSparse()) {
+        if (const auto stored = object()->template findSparseValue<Label>())
+            return *static_cast<const Value *>(stored->constData());
+
+        return defaultValue();
+    } else {
+        return m_value;
+    }
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline const Value &Property<Object, Value, Label, Features>::defaultValue()
+requires(isResetable() || isSparse())
+{
+    static const auto s_defaultValue = ObjectType::template declaredDefaultValue<Label, Value>();
+    return s_defaultValue;
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::storeSparseValue(Value &&value) requires(isSparse())
+{
+    if (detail::isChanged<Features>(defaultValue(), value))
+        object()->template storeSparseValue<Label>(std::move(value));
+    else
+        object()->template eraseSparseValue<Label>();
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::resetValue()
+{
+    static_assert(isResetable());
+    setValueImpl(Value{defaultValue()});
+}
+
 template <class Object, typename Value, LabelId Label, FeatureSet Features>
 inline void Property<Object, Value, Label, Features>::setValue(PublicValue newValue)
 {
@@ -276,11 +818,205 @@ inline void Property<Object, Value, Label, Features>::setValue(ProtectedValue ne
 template <class Object, typename Value, LabelId Label, FeatureSet Features>
 inline void Property<Object, Value, Label, Features>::setValueImpl(Value &&newValue)
 {
+    // Most properties are not observed, nor tracked most of the time. Skip comparing, and
+    // copying the value for the signal's arguments, if nobody would learn about the change.
+    const auto notifying = hasReceivers();
+    const auto tracking = isRecordingChanges();
+
+    if constexpr (isAtomic()) {
+        if (!notifying && !tracking && !hasDependents()) {
+            m_value.store(newValue, std::memory_order_release);
+            return;
+        }
+
+        // Only replace the value that was compared, also if another thread writes.
+        auto oldValue = m_value.load(std::memory_order_relaxed);
+
+        do {
+            if (!detail::isChanged<Features>(oldValue, newValue))
+                return;
+        } while (!m_value.compare_exchange_weak(oldValue, newValue,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+    } else if constexpr (isSparse()) {
+        if (!detail::isChanged<Features>(std::as_const(*this).storedValue(), newValue))
+            return;
+
+        storeSparseValue(std::move(newValue));
+    } else {
+        const auto oldValue = std::exchange(storedValue(), std::move(newValue));
+
+        if (!notifying && !tracking && !hasDependents())
+            return;
+        if (!detail::isChanged<Features>(oldValue, std::as_const(*this).storedValue()))
+            return;
+    }
+
+    if (tracking)
+        markChanged();
+
+    // Computed properties are updated first, so that receivers of this property
+    // already read their new values. They are notified after this property.
+    if constexpr (hasDependents())
+        invalidateDependents();
+
+    // Receivers in other threads might read the snapshot when notified. Atomic
+    // properties are written by any thread, and get published with the next
+    // change made by the object's thread.
+    if constexpr (!isAtomic()) {
+        if (tracking)
+            publishChange();
+    }
+
     if constexpr (isNotifiable()) {
-        if (std::exchange(m_value, std::move(newValue)) != m_value)
-            notify(m_value);
+        if (notifying)
+            notifyChange();
+    }
+
+    if constexpr (hasDependents())
+        notifyDependents();
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+template <std::invocable<Value &> Modifier>
+inline void Property<Object, Value, Label, Features>::modifyImpl(Modifier &&modifier)
+{
+    if constexpr (isAtomic()) {
+        auto oldValue = m_value.load(std::memory_order_relaxed);
+        auto newValue = oldValue;
+
+        // The modifier is applied again, if another thread wrote meanwhile.
+        do {
+            newValue = oldValue;
+
+            if constexpr (std::is_same_v<std::invoke_result_t<Modifier, Value &>, bool>) {
+                if (!std::invoke(modifier, newValue))
+                    return;
+            } else {
+                std::invoke(modifier, newValue);
+            }
+        } while (!m_value.compare_exchange_weak(oldValue, newValue,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed));
+    } else if constexpr (isSparse()) {
+        // The modifier works on a copy, as the stored value only exists if it differs
+        // from the default, and might move when other sparse properties are stored.
+        auto newValue = Value{std::as_const(*this).storedValue()};
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Modifier, Value &>, bool>) {
+            if (!std::invoke(std::forward<Modifier>(modifier), newValue))
+                return;
+        } else {
+            std::invoke(std::forward<Modifier>(modifier), newValue);
+        }
+
+        storeSparseValue(std::move(newValue));
     } else {
-        m_value = std::move(newValue);
+        auto changed = true;
+
+        if constexpr (std::is_same_v<std::invoke_result_t<Modifier, Value &>, bool>)
+            changed = std::invoke(std::forward<Modifier>(modifier), storedValue());
+        else
+            std::invoke(std::forward<Modifier>(modifier), storedValue());
+
+        if (!changed)
+            return;
+    }
+
+    const auto tracking = isRecordingChanges();
+
+    if (tracking)
+        markChanged();
+
+    if constexpr (hasDependents())
+        invalidateDependents();
+
+    if constexpr (!isAtomic()) {
+        if (tracking)
+            publishChange();
+    }
+
+    if constexpr (isNotifiable()) {
+        if (hasReceivers())
+            notifyChange();
+    }
+
+    if constexpr (hasDependents())
+        notifyDependents();
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::post(Value newValue) requires(isWritable())
+{
+    constexpr auto propertyIndex = ObjectType::MetaObject::template propertyIndex<Label>();
+    static_assert(propertyIndex >= 0, "There is no property with this label");
+
+    auto write = detail::PostedWritePool::make<PostedValue>();
+    write->propertyIndex = propertyIndex;
+    write->consume = &Property::consumePostedValue;
+    write->value = std::move(newValue);
+
+    object()->postWrite(write.release());
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::consumePostedValue(QObject *object,
+                                                                         detail::PostedWrite *write,
+                                                                         bool apply)
+{
+    const auto value = std::unique_ptr<PostedValue, detail::PostedWritePool::Deleter>{
+            static_cast<PostedValue *>(write)};
+
+    if (apply)
+        resolve(object)->setValueImpl(std::move(value->value));
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::compute() const requires(isComputed())
+{
+    Q_ASSERT(m_value.function != nullptr);
+
+    const auto target = object();
+    const auto evaluation = target->template beginEvaluation<Label>();
+    m_value.value = m_value.function(*target);
+    m_value.valid = true;
+    target->endEvaluation(evaluation);
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline detail::Expiry Property<Object, Value, Label, Features>::invalidate(detail::Recomputation recomputation)
+requires(isComputed())
+{
+    // Properties without receivers get computed when read next. If the value
+    // already was invalid, so are the values of all properties depending on it.
+    if (recomputation == detail::Recomputation::Lazy && !hasReceivers()) {
+        return std::exchange(m_value.valid, false) ? detail::Expiry::Invalidated
+                                                   : detail::Expiry::Unchanged;
+    }
+
+    // Properties with receivers are computed immediately, so that
+    // the notification is only emitted if the value has changed.
+    // So are all properties updated by the threads of ParallelEvaluation,
+    // as otherwise the object's thread would compute them when reading.
+    const auto oldValue = std::move(m_value.value);
+    compute();
+
+    return detail::isChanged<Features>(oldValue, m_value.value) ? detail::Expiry::Changed
+                                                                : detail::Expiry::Unchanged;
+}
+
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline void Property<Object, Value, Label, Features>::notifyChange()
+{
+    if constexpr (hasFeature(Feature::Coalesce)) {
+        object()->template coalesceNotification<Label>();
+    } else if (object()->template deferNotification<Label>()) {
+        return;
+    } else if constexpr (hasFeature(Feature::Throttle)) {
+        if (!object()->template throttleNotification<Label>(throttleInterval(Features)))
+            notify(value());
+    } else {
+        notify(value());
     }
 }
 
@@ -295,6 +1031,15 @@ inline void Property<Object, Value, Label, Features>::notify(Value newValue)
     (target->*activateSignal)(std::move(newValue));
 }
 
+template <class Object, typename Value, LabelId Label, FeatureSet Features>
+inline bool Property<Object, Value, Label, Features>::hasReceivers() const noexcept
+{
+    if constexpr (isNotifiable())
+        return object()->template isNotifySignalConnected<Label>();
+    else
+        return false;
+}
+
 } // namespace nproperty
 
 #endif // NPROPERTY_NPROPERTY_H
@@ -3,14 +3,137 @@
 
 #include <QtGlobal>
 
+#include <atomic>
+#include <concepts>
+#include <memory>
+#include <new>
+
+class QObject;
+
 namespace nproperty::detail {
 
+struct MemberInfo;
+class PostedWritePool;
+
+/// What became of a computed property, when a property it has read was changed.
+///
+enum class Expiry
+{
+    Unchanged,      // it was computed again, and its value didn't change
+    Invalidated,    // it will be computed again when read next
+    Changed,        // it was computed again, and its new value must be notified
+};
+
+/// When a computed property is computed again, after a property it has read was changed.
+///
+enum class Recomputation
+{
+    Lazy,           // immediately if it has receivers, otherwise when read next
+    Eager,          // immediately, as done by the threads of `ParallelEvaluation`
+};
+
 /// A tagging type that's use to generate individual functions for various
 /// class members. Usually the current line number is used as argument.
 ///
 template <quintptr N>
 struct Tag {};
 
+/// A property value that was posted by some thread, see `Property::post()`. The
+/// `consume` function applies the value to `object`, if requested, and releases it.
+///
+struct PostedWrite
+{
+    using ConsumeFunction = void (*)(QObject *object, PostedWrite *write, bool apply);
+
+    PostedWrite     *next          = nullptr;
+    int              propertyIndex = -1;
+    ConsumeFunction  consume       = nullptr;
+    PostedWritePool *pool          = nullptr;
+};
+
+/// Recycles the storage of posted writes, so that posting doesn't allocate once the
+/// posting thread has warmed up. Each thread owns one pool per node size, and only that
+/// thread takes storage from it. The object's thread releases the writes. Their storage
+/// goes to a stack of the pool, which any thread can push to without locking, and which
+/// the pool's thread takes at once when it runs out of storage. A pool outlives its
+/// thread until all of its writes have been released.
+///
+class PostedWritePool
+{
+public:
+    /// Destroys a node made by `make()`, and returns its storage to its pool.
+    ///
+    struct Deleter
+    {
+        template<std::derived_from<PostedWrite> Node>
+        void operator()(Node *node) const noexcept
+        {
+            const auto pool = node->pool;
+            node->~Node();
+            pool->release(node);
+        }
+    };
+
+    /// Makes a node with storage from the pool of the calling thread.
+    ///
+    template<std::derived_from<PostedWrite> Node>
+    [[nodiscard]] static std::unique_ptr<Node, Deleter> make()
+    {
+        auto &pool = local<sizeof(Node), alignof(Node)>();
+        const auto storage = pool.allocate();
+
+        try {
+            const auto node = new (storage) Node{};
+            node->pool = &pool;
+            return std::unique_ptr<Node, Deleter>{node};
+        } catch (...) {
+            pool.release(storage);
+            throw;
+        }
+    }
+
+    [[nodiscard]] void *allocate();
+    void release(void *storage) noexcept;
+
+private:
+    struct Block
+    {
+        Block *next;
+    };
+
+    /// Ties a pool to the lifetime of its thread.
+    ///
+    struct Owner
+    {
+        Owner(std::size_t size, std::size_t alignment);
+        ~Owner();
+
+        Owner(const Owner &) = delete;
+        Owner &operator=(const Owner &) = delete;
+
+        PostedWritePool *pool;
+    };
+
+    template<std::size_t Size, std::size_t Alignment>
+    [[nodiscard]] static PostedWritePool &local()
+    {
+        static_assert(Size >= sizeof(Block) && Alignment >= alignof(Block));
+
+        thread_local auto owner = Owner{Size, Alignment};
+        return *owner.pool;
+    }
+
+    PostedWritePool(std::size_t size, std::size_t alignment) noexcept;
+
+    void unref() noexcept;
+
+    std::size_t              m_size;
+    std::align_val_t         m_alignment;
+    Block                   *m_free       = nullptr;  // only used by the pool's thread
+    std::atomic<Block *>     m_released   = nullptr;
+    std::atomic<std::size_t> m_references = 1;        // the owner, and each node in use
+};
+
 } // namespace nproperty::detail
 
 #endif // NPROPERTY_NPROPERTY_P_H
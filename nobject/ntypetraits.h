@@ -3,6 +3,16 @@
 
 #include <algorithm>
 
+/// Most compilers can compute member offsets at compile time, even for classes
+/// that are not standard-layout, like all QObjects. Where this is not possible,
+/// `Prototype` is used to compute member offsets at runtime.
+///
+#ifdef __has_builtin
+#if    __has_builtin(__builtin_offsetof)
+#define NPROPERTY_HAS_BUILTIN_OFFSETOF
+#endif
+#endif
+
 namespace nproperty::detail {
 
 /// Retrieve well defined addresses for objects and their members,
@@ -29,6 +29,38 @@ QString SObjectTest::writable() const
     return m_writable;
 }
 
+void SObjectReset::setTitle(QString newTitle)
+{
+    if (std::exchange(m_title, std::move(newTitle)) != m_title)
+        emit titleChanged(m_title);
+}
+
+void SObjectReset::resetTitle()
+{
+    setTitle(u"untitled"_qs);
+}
+
+QString SObjectReset::title() const
+{
+    return m_title;
+}
+
+void SObjectReset::setCount(int newCount)
+{
+    if (std::exchange(m_count, newCount) != m_count)
+        emit countChanged(m_count);
+}
+
+void SObjectReset::resetCount()
+{
+    setCount(1);
+}
+
+int SObjectReset::count() const
+{
+    return m_count;
+}
+
 } // namespace spropertytest
 
 #include "moc_sobjecttest.cpp"
@@ -59,6 +59,35 @@ private:
     QString m_writable  = u"I am modifiable"_qs;
 };
 
+/// Resetable properties, as they are implemented with moc: The default
+/// values are repeated by the reset methods.
+///
+class SObjectReset : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QString title READ title WRITE setTitle RESET resetTitle NOTIFY titleChanged FINAL)
+    Q_PROPERTY(int count READ count WRITE setCount RESET resetCount NOTIFY countChanged FINAL)
+
+public:
+    using QObject::QObject;
+
+    void setTitle(QString newTitle);
+    void resetTitle();
+    QString title() const;
+
+    void setCount(int newCount);
+    void resetCount();
+    int count() const;
+
+signals:
+    void titleChanged(QString title);
+    void countChanged(int count);
+
+private:
+    QString m_title = u"untitled"_qs;
+    int     m_count = 1;
+};
+
 } // namespace spropertytest
 
 #endif // SPROPERTY_SOBJECTTEST_H